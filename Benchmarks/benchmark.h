@@ -0,0 +1,324 @@
+﻿#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Общая часть бенчмарка очередей с приоритетами: нагрузки, счетчики и реестр реализаций.
+// Нагрузки - шаблоны над адаптером, поэтому вызовы операций кучи встраиваются
+// и не несут накладных расходов виртуальных функций. Адаптер - класс вида
+//
+//   struct Adapter {
+//       explicit Adapter(size_t capacity);        // capacity - ожидаемое число элементов (и вершин)
+//       void push(uint64_t key, uint32_t id);
+//       BenchEntry pop();                          // элемент с минимальным ключом
+//       bool empty() const;
+//       void decreaseKey(uint32_t id, uint64_t key);
+//   };
+//
+// Кучи без уменьшения ключа реализуют decreaseKey повторной вставкой (ленивое удаление):
+// нагрузки сами пропускают устаревшие элементы при извлечении.
+// Новая реализация добавляется функцией registerHeap<Adapter>("имя").
+
+struct BenchEntry {
+    uint64_t key;
+    uint32_t id;
+};
+
+// Счетчик сравнений: компараторы адаптеров увеличивают его при каждом вызове
+extern uint64_t benchComparisons;
+
+enum Workload {
+    WORKLOAD_INSERT,       // n вставок случайных ключей
+    WORKLOAD_POP,          // n извлечений из заполненной кучи
+    WORKLOAD_MIXED,        // чередование вставок и извлечений при размере кучи n / 2 (очередь событий)
+    WORKLOAD_DECREASE_KEY, // n уменьшений ключа в куче из n элементов и опустошение кучи
+    WORKLOAD_DIJKSTRA,     // алгоритм Дейкстры на случайном графе из n / 4 вершин и n ребер
+    WORKLOAD_COUNT
+};
+
+struct BenchResult {
+    uint64_t operations;
+    uint64_t nanoseconds;
+    uint64_t comparisons;
+    int64_t cacheMisses; // -1, если аппаратные счетчики недоступны
+    uint64_t checksum;   // Сумма извлеченных ключей - защита от выбрасывания работы компилятором
+};
+
+typedef BenchResult (*BenchFunction)(Workload workload, size_t n, uint64_t seed);
+
+struct HeapEntry {
+    std::string name;
+    BenchFunction run;
+};
+
+std::vector<HeapEntry>& benchRegistry();
+
+// Быстрый генератор xorshift64 - одинаковые последовательности для всех реализаций
+struct BenchRandom {
+    uint64_t state;
+
+    explicit BenchRandom(uint64_t seed) : state(seed * 0x9E3779B97F4A7C15ull | 1) {}
+
+    uint64_t next() {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+// Промахи кэша последнего уровня через perf_event_open (только Linux, при наличии прав)
+class CacheMissCounter {
+public:
+    CacheMissCounter() : fd(-1) {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    void start() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Количество промахов с момента start() или -1
+    int64_t stop() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            int64_t value = 0;
+            if (read(fd, &value, sizeof(value)) == (ssize_t)sizeof(value)) {
+                return value;
+            }
+        }
+#endif
+        return -1;
+    }
+
+private:
+    int fd;
+};
+
+// Измерение участка нагрузки: время, сравнения и промахи кэша
+class BenchTimer {
+public:
+    BenchTimer() : comparisonsStart(0) {}
+
+    void start() {
+        comparisonsStart = benchComparisons;
+        misses.start();
+        startTime = std::chrono::steady_clock::now();
+    }
+
+    void stop(BenchResult& result) {
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        result.cacheMisses = misses.stop();
+        result.comparisons = benchComparisons - comparisonsStart;
+        result.nanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - startTime).count();
+    }
+
+private:
+    CacheMissCounter misses;
+    uint64_t comparisonsStart;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+// Случайный граф для нагрузки Дейкстры в виде списков смежности
+struct BenchGraph {
+    std::vector<uint32_t> offsets; // Начало списка ребер вершины
+    std::vector<uint32_t> targets;
+    std::vector<uint32_t> weights;
+};
+
+inline void benchMakeGraph(BenchGraph& graph, size_t vertices, size_t edges, uint64_t seed) {
+    BenchRandom random(seed);
+    size_t degree = vertices ? edges / vertices : 0;
+    graph.offsets.assign(vertices + 1, 0);
+    graph.targets.resize(vertices * degree);
+    graph.weights.resize(vertices * degree);
+    for (size_t v = 0; v < vertices; v++) {
+        graph.offsets[v] = (uint32_t)(v * degree);
+        for (size_t i = 0; i < degree; i++) {
+            // Половина ребер - к близким вершинам, как в дорожных сетях, половина - случайные
+            uint64_t r = random.next();
+            size_t target = (i % 2) ? (v + 1 + r % 16) % vertices : r % vertices;
+            graph.targets[v * degree + i] = (uint32_t)target;
+            graph.weights[v * degree + i] = (uint32_t)(1 + (r >> 32) % 1000);
+        }
+    }
+    graph.offsets[vertices] = (uint32_t)(vertices * degree);
+}
+
+template <typename Adapter>
+BenchResult benchRun(Workload workload, size_t n, uint64_t seed) {
+    BenchResult result = BenchResult();
+    BenchRandom random(seed);
+    BenchTimer timer;
+    switch (workload) {
+    case WORKLOAD_INSERT: {
+        Adapter heap(n);
+        timer.start();
+        for (size_t i = 0; i < n; i++) {
+            heap.push(random.next() >> 16, (uint32_t)i);
+        }
+        timer.stop(result);
+        result.operations = n;
+        break;
+    }
+    case WORKLOAD_POP: {
+        Adapter heap(n);
+        for (size_t i = 0; i < n; i++) {
+            heap.push(random.next() >> 16, (uint32_t)i);
+        }
+        timer.start();
+        while (!heap.empty()) {
+            result.checksum += heap.pop().key;
+        }
+        timer.stop(result);
+        result.operations = n;
+        break;
+    }
+    case WORKLOAD_MIXED: {
+        // Ключи растут, как время событий: новое событие позже только что обработанного
+        // Каждая вставка получает новый номер, всего номеров не больше n + n / 2
+        Adapter heap(n + n / 2);
+        uint64_t time = 0;
+        uint32_t nextId = 0;
+        for (size_t i = 0; i < n / 2; i++) {
+            heap.push(random.next() % 1000000, nextId++);
+        }
+        timer.start();
+        for (size_t i = 0; i < n; i++) {
+            if (i % 2 == 0 || heap.empty()) {
+                heap.push(time + random.next() % 1000000, nextId++);
+            }
+            else {
+                BenchEntry entry = heap.pop();
+                time = entry.key;
+                result.checksum += time;
+            }
+        }
+        timer.stop(result);
+        result.operations = n;
+        break;
+    }
+    case WORKLOAD_DECREASE_KEY: {
+        Adapter heap(n);
+        std::vector<uint64_t> keys(n);
+        for (size_t i = 0; i < n; i++) {
+            keys[i] = (random.next() >> 16) | (1ull << 46);
+            heap.push(keys[i], (uint32_t)i);
+        }
+        timer.start();
+        for (size_t i = 0; i < n; i++) {
+            uint32_t id = (uint32_t)(random.next() % n);
+            keys[id] -= keys[id] >> 4;
+            heap.decreaseKey(id, keys[id]);
+        }
+        size_t pops = 0;
+        while (!heap.empty()) {
+            BenchEntry entry = heap.pop();
+            pops++;
+            if (entry.key == keys[entry.id]) {
+                result.checksum += entry.key;
+            }
+        }
+        timer.stop(result);
+        result.operations = n + pops;
+        break;
+    }
+    case WORKLOAD_DIJKSTRA: {
+        size_t vertices = n / 4 ? n / 4 : 1;
+        BenchGraph graph;
+        benchMakeGraph(graph, vertices, n, seed);
+        const uint64_t INF = (uint64_t)-1;
+        std::vector<uint64_t> distance(vertices, INF);
+        std::vector<unsigned char> state(vertices, 0); // 0 - не в куче, 1 - в куче, 2 - готова
+        Adapter heap(vertices);
+        uint64_t operations = 1;
+        timer.start();
+        distance[0] = 0;
+        heap.push(0, 0);
+        state[0] = 1;
+        while (!heap.empty()) {
+            BenchEntry entry = heap.pop();
+            operations++;
+            if (state[entry.id] == 2 || entry.key != distance[entry.id]) {
+                continue;
+            }
+            state[entry.id] = 2;
+            for (uint32_t e = graph.offsets[entry.id]; e < graph.offsets[entry.id + 1]; e++) {
+                uint32_t target = graph.targets[e];
+                uint64_t candidate = entry.key + graph.weights[e];
+                if (candidate < distance[target]) {
+                    distance[target] = candidate;
+                    if (state[target] == 1) {
+                        heap.decreaseKey(target, candidate);
+                    }
+                    else {
+                        heap.push(candidate, target);
+                        state[target] = 1;
+                    }
+                    operations++;
+                }
+            }
+        }
+        timer.stop(result);
+        for (size_t v = 0; v < vertices; v++) {
+            if (distance[v] != INF) {
+                result.checksum += distance[v];
+            }
+        }
+        result.operations = operations;
+        break;
+    }
+    default:
+        break;
+    }
+    return result;
+}
+
+// Регистрация реализации под именем name
+template <typename Adapter>
+void registerHeap(const std::string& name) {
+    HeapEntry entry;
+    entry.name = name;
+    entry.run = &benchRun<Adapter>;
+    benchRegistry().push_back(entry);
+}
+
+#endif
@@ -0,0 +1,89 @@
+﻿#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../LibraryCPPTemplate/concurrentHashTable.h"
+
+// Бенчмарк ConcurrentHashTable против одной HashTable под общим мьютексом.
+// Запуск: hashBench [операций]; по умолчанию 4e5 операций на каждое число потоков (1 ... 64).
+// Нагрузка - в основном чтение: на каждые 20 операций приходится одно добавление,
+// ключи выбираются случайно из 10000.
+// Цифры имеют смысл только в оптимизированной сборке: cmake -DCMAKE_BUILD_TYPE=Release.
+
+const size_t KEYS = 10000;
+
+// Быстрый генератор xorshift64 со своим состоянием в каждом потоке
+uint64_t nextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// Время выполнения operations операций, разделенных между threads потоками, в секундах
+template <typename Table>
+double runReadMostly(Table& table, size_t threads, size_t operations) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&table, threads, operations, t]() {
+            uint64_t state = t * 0x9E3779B97F4A7C15ull + 1;
+            size_t count = operations / threads;
+            for (size_t i = 0; i < count; i++) {
+                uint64_t key = nextRandom(state) % KEYS;
+                if (i % 20 == 0) {
+                    table.add(key, key);
+                }
+                else {
+                    table.find(key);
+                }
+            }
+        }));
+    }
+    for (size_t t = 0; t < workers.size(); t++) {
+        workers[t].join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Точка отсчета: одна HashTable под общим мьютексом
+struct LockedTable {
+    std::mutex mutex;
+    HashTable<uint64_t, uint64_t> table;
+
+    void add(uint64_t key, uint64_t value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        table.add(key, value);
+    }
+
+    std::pair<bool, uint64_t> find(uint64_t key) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return table.find(key);
+    }
+};
+
+int main(int argc, char** argv) {
+    size_t operations = 400000;
+    if (argc > 1) {
+        double value = std::strtod(argv[1], nullptr);
+        if (argc > 2 || value < 1 || value > 1e10) {
+            std::fprintf(stderr, "Usage: %s [operations]\n", argv[0]);
+            return 1;
+        }
+        operations = (size_t)value;
+    }
+
+    std::printf("%-8s %22s %22s\n", "threads", "ConcurrentHashTable", "locked HashTable");
+    for (size_t t = 1; t <= 64; t *= 2) {
+        ConcurrentHashTable<uint64_t, uint64_t> concurrent;
+        LockedTable locked;
+        double concurrentTime = runReadMostly(concurrent, t, operations);
+        double lockedTime = runReadMostly(locked, t, operations);
+        std::printf("%-8zu %16.0f ops/s %16.0f ops/s\n", t, operations / concurrentTime, operations / lockedTime);
+    }
+    return 0;
+}
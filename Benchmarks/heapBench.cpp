@@ -0,0 +1,297 @@
+﻿#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "../LibraryCPP/priorityQueue.h"
+#include "../LibraryCPPTemplate/binaryHeap.h"
+#include "../LibraryCPPTemplate/indexedHeap.h"
+#include "../LibraryCPPTemplate/pairingHeap.h"
+
+// Бенчмарк очередей с приоритетами.
+// Запуск: heapBench [размеры...] [--heap подстрока] [--workload insert|pop|mixed|decrease-key|dijkstra]
+// Размеры - число элементов, можно в виде 1e6; по умолчанию 1e3, 1e5 и 1e6.
+// Для каждой реализации и нагрузки печатаются наносекунды и сравнения на операцию,
+// а также промахи кэша, если доступны аппаратные счетчики (perf_event_open в Linux).
+// Цифры имеют смысл только в оптимизированной сборке: cmake -DCMAKE_BUILD_TYPE=Release.
+
+uint64_t benchComparisons = 0;
+
+std::vector<HeapEntry>& benchRegistry() {
+    static std::vector<HeapEntry> registry;
+    return registry;
+}
+
+// Компараторы со счетчиком сравнений
+struct CountingLess {
+    bool operator()(const BenchEntry& a, const BenchEntry& b) const {
+        benchComparisons++;
+        return a.key < b.key;
+    }
+};
+
+struct CountingGreater {
+    bool operator()(const BenchEntry& a, const BenchEntry& b) const {
+        benchComparisons++;
+        return a.key > b.key;
+    }
+};
+
+struct CountingKeyLess {
+    bool operator()(uint64_t a, uint64_t b) const {
+        benchComparisons++;
+        return a < b;
+    }
+};
+
+// std::priority_queue - максимальная куча, поэтому компаратор обратный
+class StdQueueAdapter {
+public:
+    explicit StdQueueAdapter(size_t capacity) {
+        std::vector<BenchEntry> storage;
+        storage.reserve(capacity);
+        queue = Queue(CountingGreater(), std::move(storage));
+    }
+
+    void push(uint64_t key, uint32_t id) {
+        BenchEntry entry = { key, id };
+        queue.push(entry);
+    }
+
+    BenchEntry pop() {
+        BenchEntry entry = queue.top();
+        queue.pop();
+        return entry;
+    }
+
+    bool empty() const { return queue.empty(); }
+
+    void decreaseKey(uint32_t id, uint64_t key) { push(key, id); }
+
+private:
+    typedef std::priority_queue<BenchEntry, std::vector<BenchEntry>, CountingGreater> Queue;
+    Queue queue;
+};
+
+// Элемент очереди библиотеки на C: указатель на запись из пула адаптера
+struct LibraryItem {
+    uint64_t key;
+    uint32_t id;
+};
+
+static int libraryItemComparator(const void* a, const void* b) {
+    benchComparisons++;
+    uint64_t first = ((const LibraryItem*)a)->key;
+    uint64_t second = ((const LibraryItem*)b)->key;
+    return first < second ? -1 : (first > second ? 1 : 0);
+}
+
+static void libraryItemDestructor(void*) {
+}
+
+// PriorityQueue из LibraryCPP: сравнение через указатель на функцию, элементы - void*.
+// Записи берутся из пула со списком свободных, чтобы измерять очередь, а не new/delete.
+// Пул - std::deque: при росте записи не переезжают и указатели в очереди остаются верными
+class LibraryQueueAdapter {
+public:
+    explicit LibraryQueueAdapter(size_t capacity)
+        : queue(priorityQueue_create(capacity ? capacity : 1, libraryItemComparator, libraryItemDestructor)) {}
+
+    ~LibraryQueueAdapter() {
+        priorityQueue_delete(queue);
+    }
+
+    LibraryQueueAdapter(const LibraryQueueAdapter&) = delete;
+    LibraryQueueAdapter& operator=(const LibraryQueueAdapter&) = delete;
+
+    void push(uint64_t key, uint32_t id) {
+        LibraryItem* item;
+        if (!freeItems.empty()) {
+            item = freeItems.back();
+            freeItems.pop_back();
+        }
+        else {
+            items.push_back(LibraryItem());
+            item = &items.back();
+        }
+        item->key = key;
+        item->id = id;
+        priorityQueue_insert(queue, item);
+    }
+
+    BenchEntry pop() {
+        LibraryItem* item = (LibraryItem*)priorityQueue_extractMin(queue);
+        BenchEntry entry = { item->key, item->id };
+        freeItems.push_back(item);
+        return entry;
+    }
+
+    bool empty() const {
+        return priorityQueue_empty(queue);
+    }
+
+    void decreaseKey(uint32_t id, uint64_t key) {
+        push(key, id);
+    }
+
+private:
+    PriorityQueue* queue;
+    std::deque<LibraryItem> items;
+    std::vector<LibraryItem*> freeItems;
+};
+
+// Шаблонная куча LibraryCPPTemplate с заданной арностью
+template <size_t Arity>
+class TemplateHeapAdapter {
+public:
+    explicit TemplateHeapAdapter(size_t capacity) {
+        heap.reserve(capacity);
+    }
+
+    void push(uint64_t key, uint32_t id) {
+        BenchEntry entry = { key, id };
+        heap.insert(entry);
+    }
+
+    BenchEntry pop() { return heap.extractMin(); }
+
+    bool empty() const { return heap.empty(); }
+
+    void decreaseKey(uint32_t id, uint64_t key) { push(key, id); }
+
+private:
+    BinaryHeap<BenchEntry, CountingLess, Arity> heap;
+};
+
+// Индексированная куча с настоящим уменьшением ключа
+class IndexedHeapAdapter {
+public:
+    explicit IndexedHeapAdapter(size_t capacity) : heap(capacity) {}
+
+    void push(uint64_t key, uint32_t id) { heap.insert(id, key); }
+
+    BenchEntry pop() {
+        BenchEntry entry = { heap.getMinKey(), (uint32_t)heap.getMinId() };
+        heap.extractMin();
+        return entry;
+    }
+
+    bool empty() const { return heap.empty(); }
+
+    void decreaseKey(uint32_t id, uint64_t key) { heap.decreaseKey(id, key); }
+
+private:
+    IndexedHeap<uint64_t, CountingKeyLess> heap;
+};
+
+// Парная куча: уменьшение ключа по дескрипторам
+class PairingHeapAdapter {
+public:
+    explicit PairingHeapAdapter(size_t capacity) : handles(capacity) {}
+
+    void push(uint64_t key, uint32_t id) {
+        BenchEntry entry = { key, id };
+        handles[id] = heap.insert(entry);
+    }
+
+    BenchEntry pop() { return heap.extractMin(); }
+
+    bool empty() const { return heap.empty(); }
+
+    void decreaseKey(uint32_t id, uint64_t key) {
+        BenchEntry entry = { key, id };
+        heap.decreaseKey(handles[id], entry);
+    }
+
+private:
+    PairingHeap<BenchEntry, CountingLess> heap;
+    std::vector<PairingHeap<BenchEntry, CountingLess>::Handle> handles;
+};
+
+static const char* WORKLOAD_NAMES[WORKLOAD_COUNT] = { "insert", "pop", "mixed", "decrease-key", "dijkstra" };
+
+int main(int argc, char** argv) {
+    registerHeap<LibraryQueueAdapter>("LibraryCPP PriorityQueue");
+    registerHeap<StdQueueAdapter>("std::priority_queue");
+    registerHeap<TemplateHeapAdapter<2>>("BinaryHeap");
+    registerHeap<TemplateHeapAdapter<4>>("DaryHeap<4>");
+    registerHeap<TemplateHeapAdapter<8>>("DaryHeap<8>");
+    registerHeap<IndexedHeapAdapter>("IndexedHeap");
+    registerHeap<PairingHeapAdapter>("PairingHeap");
+
+    std::vector<size_t> sizes;
+    std::string heapFilter;
+    int workloadFilter = -1;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--heap") == 0 && i + 1 < argc) {
+            heapFilter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--workload") == 0 && i + 1 < argc) {
+            i++;
+            for (int w = 0; w < WORKLOAD_COUNT; w++) {
+                if (std::strcmp(argv[i], WORKLOAD_NAMES[w]) == 0) {
+                    workloadFilter = w;
+                }
+            }
+            if (workloadFilter < 0) {
+                std::fprintf(stderr, "Unknown workload: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        else {
+            double size = std::strtod(argv[i], nullptr);
+            if (size < 1 || size > 1e9) {
+                std::fprintf(stderr, "Usage: %s [sizes...] [--heap name] [--workload insert|pop|mixed|decrease-key|dijkstra]\n", argv[0]);
+                return 1;
+            }
+            sizes.push_back((size_t)size);
+        }
+    }
+    if (sizes.empty()) {
+        sizes.push_back(1000);
+        sizes.push_back(100000);
+        sizes.push_back(1000000);
+    }
+
+    std::printf("%-26s %-13s %10s %10s %10s %12s\n", "heap", "workload", "n", "ns/op", "cmp/op", "misses/op");
+    for (size_t s = 0; s < sizes.size(); s++) {
+        size_t n = sizes[s];
+        // Маленькие размеры повторяются, чтобы время измерения было заметным
+        size_t repeats = n < 1000000 ? 1000000 / n : 1;
+        for (int w = 0; w < WORKLOAD_COUNT; w++) {
+            if (workloadFilter >= 0 && w != workloadFilter) {
+                continue;
+            }
+            for (size_t h = 0; h < benchRegistry().size(); h++) {
+                const HeapEntry& heap = benchRegistry()[h];
+                if (!heapFilter.empty() && heap.name.find(heapFilter) == std::string::npos) {
+                    continue;
+                }
+                BenchResult total = BenchResult();
+                for (size_t r = 0; r < repeats; r++) {
+                    BenchResult result = heap.run((Workload)w, n, r + 1);
+                    total.operations += result.operations;
+                    total.nanoseconds += result.nanoseconds;
+                    total.comparisons += result.comparisons;
+                    total.cacheMisses = result.cacheMisses < 0 || total.cacheMisses < 0 ? -1 : total.cacheMisses + result.cacheMisses;
+                    total.checksum += result.checksum;
+                }
+                double operations = total.operations ? (double)total.operations : 1.0;
+                std::printf("%-26s %-13s %10zu %10.1f %10.2f ", heap.name.c_str(), WORKLOAD_NAMES[w], n,
+                            total.nanoseconds / operations, total.comparisons / operations);
+                if (total.cacheMisses >= 0) {
+                    std::printf("%12.3f", total.cacheMisses / operations);
+                }
+                else {
+                    std::printf("%12s", "n/a");
+                }
+                std::printf("   [checksum %llu]\n", (unsigned long long)total.checksum);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,437 @@
+﻿#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+#include "huffmanCode.h"
+#include "huffmanWideCode.h"
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+// Потоковый архиватор на основе кодека Хаффмана: читает stdin и пишет stdout.
+// Вход разбивается на блоки, каждый блок сжимается независимо, поэтому блоки
+// одной пачки можно обрабатывать параллельно в нескольких потоках.
+//
+// Формат: "HUF1", затем последовательность блоков до конца потока.
+// Блок: режим (1 байт), размер исходных данных (4 байта), размер содержимого (4 байта), содержимое.
+
+const char HUFF_MAGIC[4] = { 'H', 'U', 'F', '1' };
+const size_t HUFF_BLOCK_HEADER_SIZE = 9;
+const size_t HUFF_MAX_BLOCK_SIZE = (size_t)1 << 30;
+const size_t HUFF_IO_BUFFER_SIZE = (size_t)1 << 20;
+
+// Режимы хранения блока
+enum HuffBlockMode : unsigned char
+{
+    HUFF_MODE_STORED = 0,  // Данные без сжатия (уровень 0 или сжатие не дало выигрыша)
+    HUFF_MODE_HUFFMAN = 1, // Байтовый код Хаффмана
+    HUFF_MODE_WIDE = 2     // Код Хаффмана над 16-битными символами
+};
+
+struct HuffOptions
+{
+    bool decompress = false;               // -d: распаковка вместо сжатия
+    size_t blockSize = (size_t)1 << 20;    // -b: размер блока
+    unsigned int threads = 1;              // -T: число потоков
+    int level = 1;                         // -l: 0 - только хранение, 1 - Хаффман, 2 - также 16-битный алфавит
+    bool bench = false;                    // --bench: статистика в stderr
+};
+
+struct HuffBlock
+{
+    std::string input;       // Входные данные блока
+    std::string output;      // Результат обработки
+    unsigned char mode = HUFF_MODE_STORED;
+    uint32_t rawSize = 0;    // Размер исходных данных (для распаковки берется из заголовка)
+    HuffmanStats stats;      // Статистика кодека для блока
+    std::string error;       // Текст ошибки, если обработка не удалась
+};
+
+// Итоговая статистика для --bench
+struct HuffTotals
+{
+    unsigned long long int bytesIn = 0;
+    unsigned long long int bytesOut = 0;
+    unsigned long long int blocks = 0;
+    unsigned long long int storedBlocks = 0;
+    HuffmanStats codec;
+};
+
+void huff_usage()
+{
+    std::cerr << "Usage: huff [-c | -d] [-b size[K|M]] [-T threads] [-l level] [--bench]\n"
+        << "  -c          compress stdin to stdout (default)\n"
+        << "  -d          decompress stdin to stdout\n"
+        << "  -b size     block size, default 1M\n"
+        << "  -T threads  number of worker threads, default 1\n"
+        << "  -l level    0 - store only, 1 - Huffman (default),\n"
+        << "              2 - also try 16-bit symbols and keep the smaller block\n"
+        << "  --bench     print throughput and per-phase timings to stderr\n";
+}
+
+// Разбор числа с необязательным суффиксом K или M
+bool huff_parseSize(const char* text, size_t& value)
+{
+    char* end = nullptr;
+    unsigned long long int number = std::strtoull(text, &end, 10);
+    if (end == text)
+        return false;
+    if (*end == 'K' || *end == 'k')
+    {
+        number <<= 10;
+        end++;
+    }
+    else if (*end == 'M' || *end == 'm')
+    {
+        number <<= 20;
+        end++;
+    }
+    if (*end != '\0')
+        return false;
+    value = (size_t)number;
+    return true;
+}
+
+// Значение опции берется либо из того же аргумента (-T16), либо из следующего (-T 16)
+const char* huff_optionValue(int argc, char** argv, int& i)
+{
+    if (argv[i][2] != '\0')
+        return argv[i] + 2;
+    if (i + 1 < argc)
+        return argv[++i];
+    return nullptr;
+}
+
+bool huff_parseOptions(int argc, char** argv, HuffOptions& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "-c") == 0)
+            options.decompress = false;
+        else if (std::strcmp(arg, "-d") == 0)
+            options.decompress = true;
+        else if (std::strcmp(arg, "--bench") == 0)
+            options.bench = true;
+        else if (std::strncmp(arg, "-b", 2) == 0)
+        {
+            const char* value = huff_optionValue(argc, argv, i);
+            if (!value || !huff_parseSize(value, options.blockSize) || options.blockSize == 0 || options.blockSize > HUFF_MAX_BLOCK_SIZE)
+                return false;
+        }
+        else if (std::strncmp(arg, "-T", 2) == 0)
+        {
+            const char* value = huff_optionValue(argc, argv, i);
+            size_t threads = 0;
+            if (!value || !huff_parseSize(value, threads) || threads == 0 || threads > 1024)
+                return false;
+            options.threads = (unsigned int)threads;
+        }
+        else if (std::strncmp(arg, "-l", 2) == 0)
+        {
+            const char* value = huff_optionValue(argc, argv, i);
+            size_t level = 0;
+            if (!value || !huff_parseSize(value, level) || level > 2)
+                return false;
+            options.level = (int)level;
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
+// Читает ровно size байт, если поток не закончится раньше; возвращает количество прочитанных байт
+size_t huff_readFully(FILE* file, char* buffer, size_t size)
+{
+    size_t total = 0;
+    while (total < size)
+    {
+        size_t count = std::fread(buffer + total, 1, size - total, file);
+        if (count == 0)
+            break;
+        total += count;
+    }
+    return total;
+}
+
+void huff_writeFully(FILE* file, const char* buffer, size_t size)
+{
+    if (size && std::fwrite(buffer, 1, size, file) != size)
+        throw std::runtime_error("write error");
+}
+
+void huff_putUint32(char* buffer, uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+        buffer[i] = (char)((value >> (8 * i)) & 0xFF);
+}
+
+uint32_t huff_getUint32(const char* buffer)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++)
+        value |= (uint32_t)(unsigned char)buffer[i] << (8 * i);
+    return value;
+}
+
+void huff_compressBlock(HuffBlock& block, int level)
+{
+    block.rawSize = (uint32_t)block.input.size();
+    if (level > 0)
+    {
+        std::istringstream in(block.input);
+        std::ostringstream out;
+        huffman_compressStream(in, out, &block.stats);
+        block.output = out.str();
+        block.mode = HUFF_MODE_HUFFMAN;
+
+        // На уровне 2 блок сжимается и по 16-битным символам, остается меньший результат
+        if (level > 1)
+        {
+            std::istringstream wideIn(block.input);
+            std::ostringstream wideOut;
+            HuffmanStats wideStats;
+            huffman_compressWideStream(wideIn, wideOut, &wideStats);
+            if (wideOut.str().size() < block.output.size())
+            {
+                block.output = wideOut.str();
+                block.mode = HUFF_MODE_WIDE;
+                block.stats = wideStats;
+            }
+        }
+
+        // Блок, который не удалось уменьшить, хранится как есть
+        if (block.output.size() < block.input.size())
+            return;
+    }
+    block.mode = HUFF_MODE_STORED;
+    block.output.swap(block.input);
+}
+
+void huff_decompressBlock(HuffBlock& block, int level)
+{
+    if (block.mode == HUFF_MODE_STORED)
+        block.output.swap(block.input);
+    else if (block.mode == HUFF_MODE_HUFFMAN)
+    {
+        std::istringstream in(block.input);
+        std::ostringstream out;
+        // Количество символов в заголовке кода должно совпасть с размером из заголовка блока,
+        // иначе поврежденный блок распаковывался бы сколь угодно долго
+        huffman_decompressStream(in, out, &block.stats, block.rawSize);
+        block.output = out.str();
+    }
+    else if (block.mode == HUFF_MODE_WIDE)
+    {
+        std::istringstream in(block.input);
+        std::ostringstream out;
+        huffman_decompressWideStream(in, out, &block.stats);
+        block.output = out.str();
+    }
+    else
+        throw std::runtime_error("unknown block mode");
+
+    if (block.output.size() != block.rawSize)
+        throw std::runtime_error("block size mismatch");
+}
+
+// Обрабатывает пачку блоков: по одному потоку на блок, последний блок - в вызывающем потоке
+void huff_processBatch(std::vector<HuffBlock>& batch, size_t count, const HuffOptions& options)
+{
+    void (*process)(HuffBlock&, int) = options.decompress ? huff_decompressBlock : huff_compressBlock;
+    auto run = [&](size_t index) {
+        try
+        {
+            process(batch[index], options.level);
+        }
+        catch (const std::exception& e)
+        {
+            batch[index].error = e.what();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i + 1 < count; i++)
+        workers.emplace_back(run, i);
+    if (count)
+        run(count - 1);
+    for (std::thread& worker : workers)
+        worker.join();
+
+    for (size_t i = 0; i < count; i++)
+        if (!batch[i].error.empty())
+            throw std::runtime_error(batch[i].error);
+}
+
+void huff_addStats(HuffTotals& totals, const HuffBlock& block)
+{
+    totals.blocks++;
+    if (block.mode == HUFF_MODE_STORED)
+        totals.storedBlocks++;
+    totals.codec.histogramNs += block.stats.histogramNs;
+    totals.codec.treeBuildNs += block.stats.treeBuildNs;
+    totals.codec.tableBuildNs += block.stats.tableBuildNs;
+    totals.codec.headerNs += block.stats.headerNs;
+    totals.codec.codingNs += block.stats.codingNs;
+    totals.codec.headerBytes += block.stats.headerBytes;
+}
+
+void huff_compress(const HuffOptions& options, HuffTotals& totals)
+{
+    huff_writeFully(stdout, HUFF_MAGIC, sizeof(HUFF_MAGIC));
+    totals.bytesOut += sizeof(HUFF_MAGIC);
+
+    std::vector<HuffBlock> batch(options.threads);
+    bool endOfInput = false;
+    while (!endOfInput)
+    {
+        // Набираем пачку блоков по числу потоков
+        size_t count = 0;
+        while (count < batch.size() && !endOfInput)
+        {
+            HuffBlock& block = batch[count];
+            block.stats = HuffmanStats();
+            block.input.resize(options.blockSize);
+            size_t read = huff_readFully(stdin, &block.input[0], options.blockSize);
+            block.input.resize(read);
+            endOfInput = read < options.blockSize;
+            if (read)
+                count++;
+        }
+
+        huff_processBatch(batch, count, options);
+
+        // Блоки записываются строго в порядке чтения
+        for (size_t i = 0; i < count; i++)
+        {
+            HuffBlock& block = batch[i];
+            char header[HUFF_BLOCK_HEADER_SIZE];
+            header[0] = (char)block.mode;
+            huff_putUint32(header + 1, block.rawSize);
+            huff_putUint32(header + 5, (uint32_t)block.output.size());
+            huff_writeFully(stdout, header, sizeof(header));
+            huff_writeFully(stdout, block.output.data(), block.output.size());
+
+            totals.bytesIn += block.rawSize;
+            totals.bytesOut += sizeof(header) + block.output.size();
+            huff_addStats(totals, block);
+        }
+    }
+}
+
+void huff_decompress(const HuffOptions& options, HuffTotals& totals)
+{
+    char magic[sizeof(HUFF_MAGIC)];
+    size_t magicRead = huff_readFully(stdin, magic, sizeof(magic));
+    if (magicRead != sizeof(magic) || std::memcmp(magic, HUFF_MAGIC, sizeof(magic)) != 0)
+        throw std::runtime_error("input is not a huff stream");
+    totals.bytesIn += sizeof(magic);
+
+    std::vector<HuffBlock> batch(options.threads);
+    bool endOfInput = false;
+    while (!endOfInput)
+    {
+        size_t count = 0;
+        while (count < batch.size())
+        {
+            char header[HUFF_BLOCK_HEADER_SIZE];
+            size_t read = huff_readFully(stdin, header, sizeof(header));
+            if (read == 0)
+            {
+                endOfInput = true;
+                break;
+            }
+            if (read != sizeof(header))
+                throw std::runtime_error("truncated block header");
+
+            HuffBlock& block = batch[count];
+            block.stats = HuffmanStats();
+            block.mode = (unsigned char)header[0];
+            block.rawSize = huff_getUint32(header + 1);
+            uint32_t payloadSize = huff_getUint32(header + 5);
+            if (block.rawSize > HUFF_MAX_BLOCK_SIZE || payloadSize > HUFF_MAX_BLOCK_SIZE)
+                throw std::runtime_error("corrupted block header");
+
+            block.input.resize(payloadSize);
+            if (huff_readFully(stdin, &block.input[0], payloadSize) != payloadSize)
+                throw std::runtime_error("truncated block");
+            totals.bytesIn += sizeof(header) + payloadSize;
+            count++;
+        }
+
+        huff_processBatch(batch, count, options);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            huff_writeFully(stdout, batch[i].output.data(), batch[i].output.size());
+            totals.bytesOut += batch[i].output.size();
+            huff_addStats(totals, batch[i]);
+        }
+    }
+}
+
+void huff_printBench(const HuffOptions& options, const HuffTotals& totals, double seconds)
+{
+    // Скорость считается по несжатым данным в обе стороны
+    unsigned long long int rawBytes = options.decompress ? totals.bytesOut : totals.bytesIn;
+    double ratio = totals.bytesIn ? (double)totals.bytesOut / (double)totals.bytesIn : 0;
+    std::cerr << (options.decompress ? "decompress" : "compress")
+        << ": " << totals.bytesIn << " -> " << totals.bytesOut << " bytes (ratio " << ratio << ")"
+        << ", " << totals.blocks << " blocks (" << totals.storedBlocks << " stored)"
+        << ", " << options.threads << " threads"
+        << ", " << seconds << " s, " << (seconds > 0 ? (double)rawBytes / seconds / 1e6 : 0) << " MB/s\n"
+        << "codec time, ns (sum over blocks): histogram " << totals.codec.histogramNs
+        << ", tree " << totals.codec.treeBuildNs
+        << ", table " << totals.codec.tableBuildNs
+        << ", header " << totals.codec.headerNs
+        << ", coding " << totals.codec.codingNs
+        << "; header bytes " << totals.codec.headerBytes << "\n";
+}
+
+int main(int argc, char** argv)
+{
+    HuffOptions options;
+    if (!huff_parseOptions(argc, argv, options))
+    {
+        huff_usage();
+        return 2;
+    }
+
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    // Большие буферы stdio: данные идут крупными блоками, а не построчно
+    std::setvbuf(stdin, nullptr, _IOFBF, HUFF_IO_BUFFER_SIZE);
+    std::setvbuf(stdout, nullptr, _IOFBF, HUFF_IO_BUFFER_SIZE);
+
+    HuffTotals totals;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    try
+    {
+        if (options.decompress)
+            huff_decompress(options, totals);
+        else
+            huff_compress(options, totals);
+        if (std::fflush(stdout) != 0)
+            throw std::runtime_error("write error");
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "huff: " << e.what() << "\n";
+        return 1;
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (options.bench)
+        huff_printBench(options, totals, elapsed.count());
+    return 0;
+}
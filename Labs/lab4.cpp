@@ -1,7 +1,9 @@
 ﻿#include <iostream>
-#include <queue>
+#include <utility>
+#include <functional>
 #include <climits>
 #include "graph.h"
+#include "indexedHeap.h"
 #include <cassert>
 
 const int INF = INT_MAX;
@@ -21,25 +23,18 @@ Vector<int> dijkstra(const Graph<Data>& graph, size_t vertex_amount, size_t star
 
     // Очередь с приоритетами для отслеживания вершин и их расстояний
 
-    // 1. std::pair<int, size_t> - тип хранимых элементов: пары, включающие расстояние и индекс вершины
-    // 2. std::vector<std::pair<int, size_t>> - контейнер, используемый внутри для хранения элементов
-    // 3. std::greater<std::pair<int, size_t>> - функциональный объект для сравнения элементов
-    std::priority_queue<std::pair<int, size_t>, std::vector<std::pair<int, size_t>>, std::greater<std::pair<int, size_t>>> minHeap;
+    // Индексированная куча: ключ - известное расстояние, идентификатор - индекс вершины.
+    // Каждая вершина лежит в куче не больше одного раза, при нахождении более короткого пути
+    // ее ключ уменьшается на месте, поэтому куча занимает O(V) и устаревших извлечений нет
+    IndexedHeap<int> minHeap(vertex_amount);
     // Добавление начальной вершины в очередь с приоритетами
-    minHeap.push(std::make_pair(0, start_vertex));
+    minHeap.insert(start_vertex, 0);
 
     // Основной цикл алгоритма Дейкстры
     // Цикл продолжается до тех пор, пока есть вершины для обработки в приоритетной очереди
     while (!minHeap.empty()) {
-        // Извлечение пары с наименьшим расстоянием и соответствующего индекса вершины из кучи
-        int distance = minHeap.top().first; // Текущее кратчайшее известное расстояние до вершины
-        size_t current_vertex = minHeap.top().second; // Индекс текущей вершины
-        minHeap.pop(); // Удаление этой пары из кучи
-
-        // Если расстояние в вершине уже меньше извлеченного расстояния, то мы уже нашли более короткий путь,
-        // и текущую вершину можно пропустить
-        if (distance > mutableGraph.getVertex(current_vertex)->getVertexData())
-            continue;
+        // Извлечение вершины с наименьшим расстоянием; расстояние до нее окончательное
+        size_t current_vertex = minHeap.extractMin(); // Индекс текущей вершины
 
         // Получаем итератор для обхода всех соседних вершин текущей вершины
         typename Graph<Data>::Iterator it = mutableGraph.getIterator(current_vertex);
@@ -58,8 +53,11 @@ Vector<int> dijkstra(const Graph<Data>& graph, size_t vertex_amount, size_t star
             // то обновляем значение расстояния в соседней вершине
             if (current_vertex_data + edge_weight < neighbor_vertex_data) {
                 mutableGraph.getVertex(neighbor_index)->setVertexData(current_vertex_data + edge_weight);
-                // Добавляем соседнюю вершину в кучу с обновленным расстоянием для дальнейшей обработки
-                minHeap.push(std::make_pair(mutableGraph.getVertex(neighbor_index)->getVertexData(), neighbor_index));
+                // Добавляем соседнюю вершину в кучу или уменьшаем ее ключ до нового расстояния
+                if (minHeap.contains(neighbor_index))
+                    minHeap.decreaseKey(neighbor_index, current_vertex_data + edge_weight);
+                else
+                    minHeap.insert(neighbor_index, current_vertex_data + edge_weight);
             }
 
             ++it; // Переходим к следующему соседу
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <chrono> // Библиотека для работы с временем
 #include "hash.h" // Подключение заголовочного файла для пользовательской хеш-таблицы
+#include "swissHashTable.h" // Хеш-таблица с управляющими байтами
 
 using namespace std;
 
@@ -18,16 +19,19 @@ string random_word() {
 }
 
 // Функция для тестирования хеш-таблицы
-void execute(HashTable* table, int size) {
+void execute(HashTable<string, string>* table, SwissHashTable<string, string>* swiss, int size) {
 	unordered_map<string, string> map; // Стандартная хеш-таблица из STL
 
 	// Переменные для измерения времени
 	chrono::system_clock::time_point start_table;
 	chrono::system_clock::time_point table_end;
+	chrono::system_clock::time_point start_swiss;
+	chrono::system_clock::time_point swiss_end;
 	chrono::system_clock::time_point start_map;
 	chrono::system_clock::time_point map_end;
 
 	chrono::duration<double> time_table; // Время выполнения для пользовательской хеш-таблицы
+	chrono::duration<double> time_swiss; // Время выполнения для SwissHashTable
 	chrono::duration<double> time_map; // Время выполнения для unordered_map
 
 	// Создание массивов для случайных ключей и значений
@@ -44,6 +48,12 @@ void execute(HashTable* table, int size) {
 	table_end = chrono::system_clock::now();
 	time_table = table_end - start_table;
 
+	// Тестирование SwissHashTable
+	start_swiss = chrono::system_clock::now();
+	for (int i = 0; i < size; i++) swiss->add(random_key[i], random_value[i]);
+	swiss_end = chrono::system_clock::now();
+	time_swiss = swiss_end - start_swiss;
+
 	// Тестирование unordered_map
 	start_map = chrono::system_clock::now();
 	for (int i = 0; i < size; i++) map[random_key[i]] = random_value[i];
@@ -51,7 +61,7 @@ void execute(HashTable* table, int size) {
 	time_map = map_end - start_map;
 
 	// Вывод результатов тестирования
-	cout << "Added " << size << " elements. My table is " << time_table.count() << ". Unordered_map is " << time_map.count() << ".\n";
+	cout << "Added " << size << " elements. My table is " << time_table.count() << ". Swiss table is " << time_swiss.count() << ". Unordered_map is " << time_map.count() << ".\n";
 
 	// Освобождение памяти, занятой массивами ключей и значений
 	delete[] random_key;
@@ -64,23 +74,25 @@ int main() {
 	srand((unsigned int)time(NULL)); // Инициализация генератора случайных чисел
 
 	// Создание экземпляра пользовательской хеш-таблицы
-	HashTable* table = new HashTable();
+	HashTable<string, string>* table = new HashTable<string, string>();
+	SwissHashTable<string, string>* swiss = new SwissHashTable<string, string>();
 
 	// Выполнение тестирования для различного количества элементов
-	execute(table, 100);
-	execute(table, 500);
-	execute(table, 1000);
-	execute(table, 5000);
-	execute(table, 10000);
-	execute(table, 50000);
-	execute(table, 100000);
-	execute(table, 500000);
+	execute(table, swiss, 100);
+	execute(table, swiss, 500);
+	execute(table, swiss, 1000);
+	execute(table, swiss, 5000);
+	execute(table, swiss, 10000);
+	execute(table, swiss, 50000);
+	execute(table, swiss, 100000);
+	execute(table, swiss, 500000);
 
 	// Освобождение памяти, занятой хеш-таблицей
 	delete table;
+	delete swiss;
 
 
-	//HashTable* table2 = new HashTable();
+	//HashTable<string, string>* table2 = new HashTable<string, string>();
 	//table2->add("@","1");
 	//table2->add("P", "2");
 	//table2->del("@");
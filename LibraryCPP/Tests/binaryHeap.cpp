@@ -58,5 +58,63 @@ int main() {
     //  
     binaryHeap_delete(heap);
 
+    //  5:      ,   
+    std::cout << " 5:     - ";
+    heap = binaryHeap_create(2, huffmanNodeComparator, huffmanNodeDestructor);
+    for (int i = 0; i < 1000; i++)
+        binaryHeap_insert(heap, huffman_createLeafNode('a', (i * 7919) % 1000));
+    bool ordered = binaryHeap_getSize(heap) == 1000;
+    for (unsigned long long int i = 0; i < 1000 && ordered; i++) {
+        HuffmanNode* node = (HuffmanNode*)binaryHeap_extractMin(heap);
+        ordered = huffman_getNodeWeight(node) == i;
+        huffman_deleteTree(node);
+    }
+    std::cout << (ordered ? "" : "") << std::endl;
+    if (!ordered)
+        return 1;
+
+    //  6: reserve  shrinkToFit  ,     
+    std::cout << " 6:     - ";
+    binaryHeap_reserve(heap, 100);
+    bool reserved = binaryHeap_getCapacity(heap) >= 100;
+    binaryHeap_shrinkToFit(heap);
+    reserved = reserved && binaryHeap_getCapacity(heap) == 0;
+    binaryHeap_setMemoryLimit(heap, 20 * sizeof(void*));
+    size_t inserted = 0;
+    for (int i = 0; i < 30; i++) {
+        HuffmanNode* node = huffman_createLeafNode('b', i);
+        if (binaryHeap_insert(heap, node))
+            inserted++;
+        else
+            huffman_deleteTree(node);
+    }
+    bool limited = reserved && inserted == 20 && binaryHeap_getSize(heap) == 20 && !binaryHeap_reserve(heap, 21);
+    std::cout << (limited ? "" : "") << std::endl;
+    binaryHeap_delete(heap);
+    if (!limited)
+        return 1;
+
+    //  7:   ,    
+    std::cout << " 7:     - ";
+    const int bulkCount = 1000;
+    void* nodes[bulkCount];
+    for (int i = 0; i < bulkCount; i++)
+        nodes[i] = huffman_createLeafNode('c', (i * 7919) % bulkCount);
+    //  500   ,      400    100
+    heap = binaryHeap_build(nodes, 500, huffmanNodeComparator, huffmanNodeDestructor);
+    bool bulk = binaryHeap_getSize(heap) == 500 && binaryHeap_insertMany(heap, nodes + 500, 400)
+        && binaryHeap_insertMany(heap, nodes + 900, 100) && binaryHeap_getSize(heap) == bulkCount;
+    void* sorted[bulkCount];
+    size_t extracted = binaryHeap_extractMany(heap, sorted, bulkCount + 10);
+    bulk = bulk && extracted == bulkCount && binaryHeap_getSize(heap) == 0;
+    for (size_t i = 0; i < extracted; i++) {
+        bulk = bulk && huffman_getNodeWeight((HuffmanNode*)sorted[i]) == i;
+        huffman_deleteTree((HuffmanNode*)sorted[i]);
+    }
+    std::cout << (bulk ? "" : "") << std::endl;
+    binaryHeap_delete(heap);
+    if (!bulk)
+        return 1;
+
     return 0;
 }
\ No newline at end of file
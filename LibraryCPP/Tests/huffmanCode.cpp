@@ -0,0 +1,137 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include "huffmanCode.h"
+
+//           
+std::string readFile(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+//        
+bool streamRoundTrip(const std::string& data)
+{
+    std::istringstream in(data);
+    std::ostringstream compressed;
+    huffman_compressStream(in, compressed);
+
+    std::istringstream compressedIn(compressed.str());
+    std::ostringstream out;
+    huffman_decompressStream(compressedIn, out);
+    return out.str() == data;
+}
+
+// true,     
+bool decompressFails(const std::string& compressed,
+    unsigned long long int expectedSymbols = HUFFMAN_ANY_SYMBOLS_COUNT)
+{
+    std::istringstream in(compressed);
+    std::ostringstream out;
+    try
+    {
+        huffman_decompressStream(in, out, nullptr, expectedSymbols);
+    }
+    catch (const std::runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    setlocale(LC_ALL, "ru");
+
+    //  :     
+    std::string text;
+    for (int i = 0; i < 2000; i++)
+        text += "abracadabra " + std::to_string(i % 17) + "\n";
+    {
+        std::ofstream fileOut("huffmanCodeTest.txt", std::ios::binary);
+        fileOut << text;
+    }
+
+    HuffmanStats compressStats;
+    std::ifstream fileIn("huffmanCodeTest.txt", std::ios::binary);
+    huffman_compress(fileIn, "huffmanCodeTest.arc", &compressStats);
+    fileIn.close();
+
+    HuffmanStats decompressStats;
+    fileIn.open("huffmanCodeTest.arc", std::ios::binary);
+    huffman_decompress(fileIn, "huffmanCodeTest.out", &decompressStats);
+    fileIn.close();
+
+    //  1:      
+    if (readFile("huffmanCodeTest.out") != text)
+    {
+        std::cout << " 1:      \n";
+        return 1;
+    }
+
+    //  2:    
+    if (compressStats.bytesIn != text.size() || compressStats.symbols != text.size()
+        || compressStats.bytesOut != readFile("huffmanCodeTest.arc").size()
+        || compressStats.bytesOut >= compressStats.bytesIn
+        || compressStats.headerBytes == 0 || compressStats.headerBytes >= compressStats.bytesOut)
+    {
+        std::cout << " 2:   \n";
+        return 1;
+    }
+
+    //  3:   
+    if (compressStats.alphabetSize == 0 || compressStats.maxCodeLength == 0
+        || compressStats.averageCodeLength <= 0 || compressStats.averageCodeLength > compressStats.maxCodeLength
+        || compressStats.averageCodeLength >= 8)
+    {
+        std::cout << " 3:   \n";
+        return 1;
+    }
+
+    //  4:  
+    if (decompressStats.bytesIn != compressStats.bytesOut || decompressStats.bytesOut != text.size()
+        || decompressStats.headerBytes != compressStats.headerBytes)
+    {
+        std::cout << " 4:   \n";
+        return 1;
+    }
+
+    //  5:  ,   ,     255
+    std::string binary;
+    for (int i = 0; i < 70000; i++)
+        binary += (char)(i % 7 == 0 ? 255 : i % 251);
+    if (!streamRoundTrip("") || !streamRoundTrip("a") || !streamRoundTrip(std::string(1000, 'z'))
+        || !streamRoundTrip(std::string(300, (char)255)) || !streamRoundTrip(binary))
+    {
+        std::cout << " 5:   \n";
+        return 1;
+    }
+
+    //  6:      ,    
+    std::istringstream abIn("abababab");
+    std::ostringstream abOut;
+    huffman_compressStream(abIn, abOut);
+    std::string ab = abOut.str();
+    //  "ab":  (3 ), , 1   , , ,  (1 )
+    std::string longCount = ab.substr(0, 4) + "\x09" + std::string(9, '\x7f') + ab.substr(6);
+    std::string hugeCount = ab.substr(0, 4) + "\x05" + std::string(5, '\x7f') + ab.substr(6);
+    std::string zeroCount = ab.substr(0, 4) + "\x01" + std::string(1, '\0') + ab.substr(6);
+    if (ab.size() != 8 || !decompressFails(longCount) || !decompressFails(hugeCount)
+        || !decompressFails(ab.substr(0, 7)) || !decompressFails(ab, 9) || decompressFails(ab, 8)
+        || decompressFails(zeroCount))
+    {
+        std::cout << " 6:    \n";
+        return 1;
+    }
+
+    std::cout << ": " << compressStats.bytesIn << " -> " << compressStats.bytesOut << " , "
+        << compressStats.averageCodeLength << " /,  (): "
+        << compressStats.histogramNs << " " << compressStats.treeBuildNs << " " << compressStats.tableBuildNs << " "
+        << compressStats.headerNs << " " << compressStats.codingNs << " " << compressStats.ioNs << "\n";
+    return 0;
+}
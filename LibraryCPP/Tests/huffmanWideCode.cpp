@@ -0,0 +1,94 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include <cstdint>
+#include "huffmanWideCode.h"
+
+//     ,     stats
+bool wideRoundTrip(const std::string& data, HuffmanStats* stats = nullptr)
+{
+    std::istringstream in(data);
+    std::ostringstream compressed;
+    huffman_compressWideStream(in, compressed, stats);
+
+    std::istringstream compressedIn(compressed.str());
+    std::ostringstream out;
+    huffman_decompressWideStream(compressedIn, out);
+    return out.str() == data;
+}
+
+void appendSymbol(std::string& data, uint32_t symbol)
+{
+    data.push_back((char)(symbol & 0xFF));
+    data.push_back((char)(symbol >> 8));
+}
+
+int main()
+{
+    setlocale(LC_ALL, "ru");
+
+    //  1:   - ,  ,  ,  
+    if (!wideRoundTrip("") || !wideRoundTrip("x") || !wideRoundTrip("xy") || !wideRoundTrip(std::string(1001, 'q')))
+    {
+        std::cout << " 1:    \n";
+        return 1;
+    }
+
+    //  2:      (   )
+    std::string tokens;
+    uint32_t seed = 12345;
+    for (int i = 0; i < 500000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        unsigned long long int random = (seed >> 8) & 0xFFFF;
+        //             
+        appendSymbol(tokens, (uint32_t)(random * random * random * random >> 48));
+    }
+    HuffmanStats stats;
+    if (!wideRoundTrip(tokens, &stats))
+    {
+        std::cout << " 2:    \n";
+        return 1;
+    }
+    if (stats.alphabetSize < 5000 || stats.symbols != 500000 || stats.bytesOut >= stats.bytesIn
+        || stats.maxCodeLength > HUFFMAN_WIDE_MAX_CODE_LENGTH || stats.averageCodeLength >= 15)
+    {
+        std::cout << " 2:  \n";
+        return 1;
+    }
+
+    //  3:        
+    std::string fibonacci;
+    unsigned long long int previous = 1, current = 1;
+    for (uint32_t symbol = 0; symbol < 26; symbol++)
+    {
+        for (unsigned long long int i = 0; i < previous; i++)
+            appendSymbol(fibonacci, symbol * 257);
+        unsigned long long int next = previous + current;
+        previous = current;
+        current = next;
+    }
+    if (!wideRoundTrip(fibonacci, &stats) || stats.maxCodeLength > HUFFMAN_WIDE_MAX_CODE_LENGTH)
+    {
+        std::cout << " 3:    \n";
+        return 1;
+    }
+
+    //  4:    ,    
+    std::string corrupted("\x00\xFF\xFF\xFF\xFF\x0F\x01\x00\x01\x00", 10);
+    try
+    {
+        std::istringstream corruptedIn(corrupted);
+        std::ostringstream out;
+        huffman_decompressWideStream(corruptedIn, out);
+        std::cout << " 4:    \n";
+        return 1;
+    }
+    catch (const std::runtime_error&)
+    {
+    }
+
+    std::cout << " " << stats.alphabetSize << ",    " << stats.maxCodeLength << "\n";
+    return 0;
+}
@@ -44,8 +44,65 @@ void testPriorityQueue() {
     priorityQueue_delete(queue);
 }
 
+//         
+bool testPriorityQueueBulk() {
+    const size_t count = 100000;
+    void** nodes = new void* [count];
+    for (size_t i = 0; i < count; i++)
+        nodes[i] = huffman_createLeafNode('a', (i * 7919) % count);
+
+    PriorityQueue* queue = priorityQueue_createFrom(nodes, count / 2, huffmanNodeComparator, huffmanNodeDestructor);
+    bool success = priorityQueue_insertMany(queue, nodes + count / 2, count - count / 2);
+    success = success && priorityQueue_getSize(queue) == count;
+
+    //   1000 :     0
+    size_t expected = 0;
+    while (success && !priorityQueue_empty(queue)) {
+        size_t extracted = priorityQueue_extractMany(queue, nodes, 1000);
+        for (size_t i = 0; i < extracted; i++) {
+            success = success && huffman_getNodeWeight((HuffmanNode*)nodes[i]) == expected++;
+            huffmanNodeDestructor(nodes[i]);
+        }
+    }
+    success = success && expected == count;
+    std::cout << "  : " << (success ? "" : "") << std::endl;
+
+    priorityQueue_delete(queue);
+    delete[] nodes;
+    return success;
+}
+
+int intComparator(const void* a, const void* b) {
+    return *(const int*)a - *(const int*)b;
+}
+
+void intDestructor(void*) {
+}
+
+//  :    ,     
+bool testPriorityQueueMemoryLimit() {
+    int values[10] = { 9, 3, 7, 1, 8, 2, 6, 0, 5, 4 };
+    PriorityQueue* queue = priorityQueue_create(1, intComparator, intDestructor);
+    priorityQueue_setMemoryLimit(queue, 8 * sizeof(void*));
+    bool success = true;
+    for (int i = 0; i < 8; i++)
+        success = success && priorityQueue_insert(queue, &values[i]);
+    void* rest[2] = { &values[8], &values[9] };
+    success = success && !priorityQueue_insert(queue, &values[8]) && !priorityQueue_insertMany(queue, rest, 2)
+        && !priorityQueue_reserve(queue, 9) && priorityQueue_getSize(queue) == 8 && priorityQueue_getCapacity(queue) == 8;
+    int order[8] = { 0, 1, 2, 3, 6, 7, 8, 9 };
+    for (int i = 0; success && i < 8; i++)
+        success = *(int*)priorityQueue_extractMin(queue) == order[i];
+    success = success && priorityQueue_extractMin(queue) == NULL && priorityQueue_getMin(queue) == NULL;
+    std::cout << " : " << (success ? "" : "") << std::endl;
+    priorityQueue_delete(queue);
+    return success;
+}
+
 int main() {
     setlocale(LC_ALL, "ru");
     testPriorityQueue();
+    if (!testPriorityQueueBulk() || !testPriorityQueueMemoryLimit())
+        return 1;
     return 0;
 }
\ No newline at end of file
@@ -1,10 +1,20 @@
 #include "binaryHeap.h"
 
+//     .    ;  4  8   ,
+//     (  8 )          -.
+//   ,  -DBINARYHEAP_ARITY=4.
+#ifndef BINARYHEAP_ARITY
+#define BINARYHEAP_ARITY 2
+#endif
+
+static_assert(BINARYHEAP_ARITY >= 2, "Heap arity must be at least 2");
+
 struct BinaryHeap
 {
     void** heapData;    //      
-    size_t heapSize;    //   ,    
+    size_t heapSize;    //  ,    
     size_t dataCount;   //     
+    size_t memoryLimit; //    heapData   (0 -  )
     Comparator compare; // -    
     Destructor destroy; // -   
 };
@@ -15,11 +25,65 @@ BinaryHeap* binaryHeap_create(const size_t size, Comparator comp, Destructor des
     heap->heapData = new void* [size];
     heap->heapSize = size;
     heap->dataCount = 0;
+    heap->memoryLimit = 0;
     heap->compare = comp;
     heap->destroy = dest;
     return heap;
 }
 
+BinaryHeap* binaryHeap_build(void** data, const size_t count, Comparator comp, Destructor dest)
+{
+    BinaryHeap* heap = binaryHeap_create(count, comp, dest);
+    for (size_t i = 0; i < count; i++)
+        heap->heapData[i] = data[i];
+    heap->dataCount = count;
+    binaryHeap_rebuild(heap);
+    return heap;
+}
+
+//      
+void binaryHeap_reallocate(BinaryHeap* heap, const size_t size)
+{
+    void** newData = new void* [size];
+    for (size_t i = 0; i < heap->dataCount; i++)
+        newData[i] = heap->heapData[i];
+    delete[] heap->heapData;
+    heap->heapData = newData;
+    heap->heapSize = size;
+}
+
+//  ,   
+size_t binaryHeap_maxCapacity(BinaryHeap* heap)
+{
+    return heap->memoryLimit ? heap->memoryLimit / sizeof(void*) : (size_t)-1 / sizeof(void*);
+}
+
+bool binaryHeap_reserve(BinaryHeap* heap, const size_t size)
+{
+    if (size <= heap->heapSize)
+        return true;
+    if (size > binaryHeap_maxCapacity(heap))
+        return false;
+    binaryHeap_reallocate(heap, size);
+    return true;
+}
+
+void binaryHeap_shrinkToFit(BinaryHeap* heap)
+{
+    if (heap->dataCount < heap->heapSize)
+        binaryHeap_reallocate(heap, heap->dataCount);
+}
+
+void binaryHeap_setMemoryLimit(BinaryHeap* heap, const size_t bytes)
+{
+    heap->memoryLimit = bytes;
+}
+
+size_t binaryHeap_getCapacity(BinaryHeap* heap)
+{
+    return heap->heapSize;
+}
+
 void binaryHeap_swapData(BinaryHeap* heap, const size_t firstIndex, const size_t secondIndex)
 {
     void* temp = heap->heapData[firstIndex];
@@ -27,37 +91,70 @@ void binaryHeap_swapData(BinaryHeap* heap, const size_t firstIndex, const size_t
     heap->heapData[secondIndex] = temp;
 }
 
-void binaryHeap_heapify(BinaryHeap* heap, int i)
+void binaryHeap_heapify(BinaryHeap* heap, size_t i)
 {
-    //          
-    int left = 2 * i + 1;  //    
-    int right = 2 * i + 2; //    
-    int smallest = i;      //   ,    
+    //  ,      .
+    //   i    BINARYHEAP_ARITY * i + 1  BINARYHEAP_ARITY * i + BINARYHEAP_ARITY.
+    while (true)
+    {
+        size_t first = BINARYHEAP_ARITY * i + 1; //    
+        if (first >= heap->dataCount)
+            break;
+        size_t last = first + BINARYHEAP_ARITY;
+        if (last > heap->dataCount)
+            last = heap->dataCount;
 
-    // ,       
-    //        
-    if (left < (int)heap->dataCount && heap->compare(heap->heapData[left], heap->heapData[smallest]) < 0)
-        smallest = left;
+        //     
+        size_t smallest = first;
+        for (size_t child = first + 1; child < last; child++)
+            if (heap->compare(heap->heapData[child], heap->heapData[smallest]) < 0)
+                smallest = child;
 
-    //     
-    if (right < (int)heap->dataCount && heap->compare(heap->heapData[right], heap->heapData[smallest]) < 0)
-        smallest = right;
+        //        ,   
+        if (heap->compare(heap->heapData[smallest], heap->heapData[i]) >= 0)
+            break;
+        binaryHeap_swapData(heap, i, smallest);
+        i = smallest;
+    }
+}
+
+//      : heapify   ,    ,  .
+//       ,    O(n) 
+void binaryHeap_rebuild(BinaryHeap* heap)
+{
+    if (heap->dataCount < 2)
+        return;
+    for (size_t i = (heap->dataCount - 2) / BINARYHEAP_ARITY + 1; i > 0; i--)
+        binaryHeap_heapify(heap, i - 1);
+}
 
-    //        ,   
-    if (smallest != i)
+//   i  ,    
+void binaryHeap_siftUp(BinaryHeap* heap, size_t i)
+{
+    //            ...
+    while (i != 0 && heap->compare(heap->heapData[(i - 1) / BINARYHEAP_ARITY], heap->heapData[i]) > 0)
     {
-        binaryHeap_swapData(heap, i, smallest);
-        //   heapify    
-        binaryHeap_heapify(heap, smallest);
+        //      .
+        binaryHeap_swapData(heap, (i - 1) / BINARYHEAP_ARITY, i);
+        //      .
+        i = (i - 1) / BINARYHEAP_ARITY;
     }
 }
 
-void binaryHeap_insert(BinaryHeap* heap, void* node)
+bool binaryHeap_insert(BinaryHeap* heap, void* node)
 {
-    // ,      .
-    //  ,     .
+    //   ,     :   O(log n)  .
+    //     ;     ,   .
     if (heap->dataCount == heap->heapSize)
-        return;
+    {
+        size_t maxCapacity = binaryHeap_maxCapacity(heap);
+        if (heap->heapSize >= maxCapacity)
+            return false;
+        size_t newSize = heap->heapSize ? heap->heapSize * 2 : 16;
+        if (newSize > maxCapacity)
+            newSize = maxCapacity;
+        binaryHeap_reallocate(heap, newSize);
+    }
 
     //       .
     heap->dataCount++;
@@ -67,14 +164,40 @@ void binaryHeap_insert(BinaryHeap* heap, void* node)
     heap->heapData[i] = node;
 
     //         .
-    //            ...
-    while (i != 0 && heap->compare(heap->heapData[(i - 1) / 2], heap->heapData[i]) > 0)
+    binaryHeap_siftUp(heap, i);
+    return true;
+}
+
+bool binaryHeap_insertMany(BinaryHeap* heap, void** data, const size_t count)
+{
+    if (count == 0)
+        return true;
+    //            ,    insert
+    size_t required = heap->dataCount + count;
+    if (required > heap->heapSize)
     {
-        //      .
-        binaryHeap_swapData(heap, (i - 1) / 2, i);
-        //      .
-        i = (i - 1) / 2;
+        size_t maxCapacity = binaryHeap_maxCapacity(heap);
+        if (required > maxCapacity)
+            return false;
+        size_t newSize = heap->heapSize * 2 > required ? heap->heapSize * 2 : required;
+        if (newSize > maxCapacity)
+            newSize = maxCapacity;
+        binaryHeap_reallocate(heap, newSize);
     }
+
+    size_t oldCount = heap->dataCount;
+    for (size_t i = 0; i < count; i++)
+        heap->heapData[oldCount + i] = data[i];
+    heap->dataCount = required;
+
+    //   O(n + count),  - O(count log n): ,
+    //      
+    if (count * 4 >= oldCount)
+        binaryHeap_rebuild(heap);
+    else
+        for (size_t i = oldCount; i < required; i++)
+            binaryHeap_siftUp(heap, i);
+    return true;
 }
 
 void* binaryHeap_extractMin(BinaryHeap* heap)
@@ -108,6 +231,14 @@ void* binaryHeap_extractMin(BinaryHeap* heap)
     return root;
 }
 
+size_t binaryHeap_extractMany(BinaryHeap* heap, void** out, const size_t count)
+{
+    size_t extracted = 0;
+    while (extracted < count && heap->dataCount > 0)
+        out[extracted++] = binaryHeap_extractMin(heap);
+    return extracted;
+}
+
 void* binaryHeap_getMin(BinaryHeap* heap)
 {
     if (heap->dataCount == 0)
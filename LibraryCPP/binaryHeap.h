@@ -8,20 +8,51 @@ typedef void (*Destructor)(void*);
 
 struct BinaryHeap;
 
+// size -  ;       
 BinaryHeap* binaryHeap_create(const size_t size, Comparator comp, Destructor dest);
 
+//     n :        O(n)
+//   O(n log n)  n .  data   .
+BinaryHeap* binaryHeap_build(void** data, const size_t count, Comparator comp, Destructor dest);
+
 void binaryHeap_swapData(BinaryHeap* heap, const size_t firstIndex, const size_t secondIndex);
 
-void binaryHeap_heapify(BinaryHeap* heap, int i);
+void binaryHeap_heapify(BinaryHeap* heap, size_t i);
+
+void binaryHeap_siftUp(BinaryHeap* heap, size_t i);
+
+//        O(n)
+void binaryHeap_rebuild(BinaryHeap* heap);
 
-void binaryHeap_insert(BinaryHeap* heap, void* node);
+//  false,        
+bool binaryHeap_insert(BinaryHeap* heap, void* node);
+
+//  count  .         
+//  O(n + count),  -    .
+//  false    ,       
+bool binaryHeap_insertMany(BinaryHeap* heap, void** data, const size_t count);
 
 void* binaryHeap_extractMin(BinaryHeap* heap);
 
+//   count        out.
+//    
+size_t binaryHeap_extractMany(BinaryHeap* heap, void** out, const size_t count);
+
 void* binaryHeap_getMin(BinaryHeap* heap);
 
 size_t binaryHeap_getSize(BinaryHeap* heap);
 
+size_t binaryHeap_getCapacity(BinaryHeap* heap);
+
+//     size ; false,     
+bool binaryHeap_reserve(BinaryHeap* heap, const size_t size);
+
+//       
+void binaryHeap_shrinkToFit(BinaryHeap* heap);
+
+//       , 0 -  
+void binaryHeap_setMemoryLimit(BinaryHeap* heap, const size_t bytes);
+
 void binaryHeap_delete(BinaryHeap* heap);
 
 #endif
\ No newline at end of file
@@ -1,47 +1,51 @@
 #include "huffmanCode.h"
 #include <vector>
 #include <map>
+#include <chrono>
 #include "array.h"
 #include "priorityQueue.h"
 #include "huffmanTree.h"
 typedef std::map<unsigned char, std::vector<bool>> symbolsTableMap;
+typedef std::chrono::steady_clock huffmanClock;
 
 struct Byte
 {
     uint8_t byte = 0;          //   
     uint8_t bitsCount = 0;     //     
-    std::ifstream& fileIn;     //     
-    Byte(std::ifstream& fileInStream) : fileIn(fileInStream) { }
+    std::istream& fileIn;      //    
+    Byte(std::istream& fileInStream) : fileIn(fileInStream) { }
 };
 
-void huffman_fileCursorPositionStart(std::ifstream& fileIn)
+void huffman_fileCursorPositionStart(std::istream& fileIn, std::streampos position)
 {
     //    
     //   ,       
     //   eof ( ),      
     fileIn.clear();
 
-    //       
-    // std::ios::beg -     ( )
-    fileIn.seekg(0, std::ios::beg);
+    //      
+    // (    ,   - ,    )
+    fileIn.seekg(position);
 }
 
-void huffman_makeAlphabet(std::ifstream& fileIn, Array* symbolsCount)
+void huffman_makeAlphabet(std::istream& fileIn, Array* symbolsCount)
 {
-    unsigned char symbol; //      
+    std::streampos start = fileIn.tellg(); // ,    
+    char symbol; //      
 
     //        
-    while (fileIn >> std::noskipws >> symbol) // std::noskipws ,        
+    // get()    ,       
+    while (fileIn.get(symbol))
     {
         //        symbolsCount
         // array_get     ,
         //       1
-        array_set(symbolsCount, symbol, array_get(symbolsCount, symbol) + 1);
+        array_set(symbolsCount, (unsigned char)symbol, array_get(symbolsCount, (unsigned char)symbol) + 1);
     }
 
     //    ,      
     //          
-    huffman_fileCursorPositionStart(fileIn);
+    huffman_fileCursorPositionStart(fileIn, start);
 }
 
 size_t huffman_alphabetGetSymbolsCount(Array* symbolsCount)
@@ -53,14 +57,18 @@ size_t huffman_alphabetGetSymbolsCount(Array* symbolsCount)
     return count;
 }
 
-void huffman_makeNodesQueue(PriorityQueue* queue, Array* symbolsCount)
+//       ,       O(n)
+PriorityQueue* huffman_makeNodesQueue(Array* symbolsCount)
 {
+    void* leaves[256];
+    size_t leavesCount = 0;
     for (uint16_t i = 0; i < 256; i++)
         if (array_get(symbolsCount, i))
-            priorityQueue_insert(queue, huffman_createLeafNode((unsigned char)i, array_get(symbolsCount, i)));
+            leaves[leavesCount++] = huffman_createLeafNode((unsigned char)i, array_get(symbolsCount, i));
+    return priorityQueue_createFrom(leaves, leavesCount, huffmanNodeComparator, huffmanNodeDestructor);
 }
 
-void huffman_writeBitToByte(std::ofstream& fileOut, Byte& byteStruct, bool bitState)
+void huffman_writeBitToByte(std::ostream& fileOut, Byte& byteStruct, bool bitState)
 {
     //               .
     //  |        bitState.
@@ -80,7 +88,7 @@ void huffman_writeBitToByte(std::ofstream& fileOut, Byte& byteStruct, bool bitSt
     }
 }
 
-void huffman_writeSymbolToFile(unsigned char symbol, std::ofstream& fileOut, Byte& byteStruct)
+void huffman_writeSymbolToFile(unsigned char symbol, std::ostream& fileOut, Byte& byteStruct)
 {
     //char = 1  = 8 
     // ,  symbol = 'A' (   0100 0001),  (symbol >> i) & 1   1, 0, 0, 0, 0, 1, 0, 0
@@ -88,7 +96,7 @@ void huffman_writeSymbolToFile(unsigned char symbol, std::ofstream& fileOut, Byt
         huffman_writeBitToByte(fileOut, byteStruct, ((symbol >> i) & 1));
 }
 
-void huffman_saveTreeToFile(std::ofstream& fileOut, HuffmanNode* node, Byte& byteStruct)
+void huffman_saveTreeToFile(std::ostream& fileOut, HuffmanNode* node, Byte& byteStruct)
 {
     // ,      
     if (huffman_nodeIsLeaf(huffman_getLeftNode(node)))
@@ -123,7 +131,7 @@ void huffman_saveTreeToFile(std::ofstream& fileOut, HuffmanNode* node, Byte& byt
     }
 }
 
-void huffman_saveTotalSymbolsToFile(std::ofstream& fileOut, unsigned long long int total)
+void huffman_saveTotalSymbolsToFile(std::ostream& fileOut, unsigned long long int total)
 {
     //        
     uint8_t byte = 0;         //    
@@ -140,6 +148,10 @@ void huffman_saveTotalSymbolsToFile(std::ofstream& fileOut, unsigned long long i
     else
         totalBytesCount = 8;
 
+    //     :       255,
+    //      
+    fileOut.put((char)totalBytesCount);
+
     //    total    
     for (uint8_t i = 0; i < totalBytesCount * 8; i++)
     {
@@ -191,19 +203,55 @@ void huffman_makeTable(HuffmanNode* node, symbolsTableMap& table, std::vector<bo
         code.pop_back();
 }
 
-void huffman_writeUncompletedByte(std::ofstream& fileOut, Byte& byteStruct)
+void huffman_writeUncompletedByte(std::ostream& fileOut, Byte& byteStruct)
 {
     while (byteStruct.bitsCount)
         huffman_writeBitToByte(fileOut, byteStruct, 0);
 }
 
-void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileName)
+unsigned long long int huffman_elapsedNs(huffmanClock::time_point& phaseStart)
+{
+    //  ,    ,      
+    huffmanClock::time_point now = huffmanClock::now();
+    unsigned long long int elapsed = (unsigned long long int)std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart).count();
+    phaseStart = now;
+    return elapsed;
+}
+
+void huffman_collectCodeStats(const symbolsTableMap& table, Array* symbolsCount, HuffmanStats* stats)
+{
+    //      ,     
+    unsigned long long int totalBits = 0;
+    for (symbolsTableMap::const_iterator it = table.begin(); it != table.end(); ++it)
+    {
+        if (it->second.size() > stats->maxCodeLength)
+            stats->maxCodeLength = it->second.size();
+        totalBits += (unsigned long long int)array_get(symbolsCount, it->first) * it->second.size();
+    }
+    stats->averageCodeLength = stats->symbols ? (double)totalBits / (double)stats->symbols : 0;
+}
+
+void huffman_compressStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats)
 {
+    huffmanClock::time_point phaseStart = huffmanClock::now();
+    HuffmanStats localStats;
+    std::streampos outStart = fileOut.tellp();
+
+    //      :      
+    if (fileIn.peek() == std::char_traits<char>::eof())
+    {
+        if (stats)
+            *stats = localStats;
+        return;
+    }
+
     Byte byteStruct(fileIn);
     Array* symbolsCount = array_create(256);
     huffman_makeAlphabet(fileIn, symbolsCount);
-    PriorityQueue* nodesQueue = priorityQueue_create(huffman_alphabetGetSymbolsCount(symbolsCount), huffmanNodeComparator, huffmanNodeDestructor);
-    huffman_makeNodesQueue(nodesQueue, symbolsCount);
+    localStats.histogramNs = huffman_elapsedNs(phaseStart);
+
+    localStats.alphabetSize = huffman_alphabetGetSymbolsCount(symbolsCount);
+    PriorityQueue* nodesQueue = huffman_makeNodesQueue(symbolsCount);
     while (priorityQueue_getSize(nodesQueue) > 1) {
 
         HuffmanNode* leftNode = (HuffmanNode*)priorityQueue_extractMin(nodesQueue);
@@ -212,16 +260,23 @@ void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileNa
         priorityQueue_insert(nodesQueue, internalNode);
     }
 
-    HuffmanNode* huffmanTree = (HuffmanNode*)priorityQueue_getMin(nodesQueue);
+    HuffmanNode* huffmanTree = (HuffmanNode*)priorityQueue_extractMin(nodesQueue);
     priorityQueue_delete(nodesQueue);
-    std::ofstream fileOut(compressedFileName, std::ios::binary);
+    localStats.symbols = huffman_getNodeWeight(huffmanTree);
+    localStats.treeBuildNs = huffman_elapsedNs(phaseStart);
+
     if (!huffman_nodeIsLeaf(huffmanTree))
+    {
         huffman_writeBitToByte(fileOut, byteStruct, 0);
+        //     
+        huffman_saveTreeToFile(fileOut, huffmanTree, byteStruct);
+    }
     else
+    {
+        //    :      
         huffman_writeBitToByte(fileOut, byteStruct, 1);
-
-    //     
-    huffman_saveTreeToFile(fileOut, huffmanTree, byteStruct);
+        huffman_writeSymbolToFile(huffman_getNodeChar(huffmanTree), fileOut, byteStruct);
+    }
     //    ,    
     huffman_writeUncompletedByte(fileOut, byteStruct);
 
@@ -229,22 +284,58 @@ void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileNa
     fileOut.put((unsigned char)255);
     huffman_saveTotalSymbolsToFile(fileOut, huffman_getNodeWeight(huffmanTree));
     fileOut.put((unsigned char)255);
+    localStats.headerBytes = (unsigned long long int)(fileOut.tellp() - outStart);
+    localStats.headerNs = huffman_elapsedNs(phaseStart);
 
     //       
     symbolsTableMap table;
     std::vector<bool> symbolCode;
     huffman_makeTable(huffmanTree, table, symbolCode);
     huffmanTree = huffman_deleteTree(huffmanTree);
+    if (stats)
+        huffman_collectCodeStats(table, symbolsCount, &localStats);
+    array_delete(symbolsCount);
+
+    //    std::map  ,  ,
+    //               
+    std::vector<bool> codes[256];
+    for (symbolsTableMap::const_iterator it = table.begin(); it != table.end(); ++it)
+        codes[it->first] = it->second;
+    localStats.tableBuildNs = huffman_elapsedNs(phaseStart);
+
     //          
-    while (!fileIn.eof())
+    char symbol;
+    while (fileIn.get(symbol))
     {
-        symbolCode = table[(unsigned char)fileIn.get()];
-        for (uint8_t i = 0; i < symbolCode.size(); i++)
-            huffman_writeBitToByte(fileOut, byteStruct, symbolCode[i]);
+        const std::vector<bool>& code = codes[(unsigned char)symbol];
+        for (size_t i = 0; i < code.size(); i++)
+            huffman_writeBitToByte(fileOut, byteStruct, code[i]);
     }
-    //       
+    //    
     huffman_writeUncompletedByte(fileOut, byteStruct);
+    localStats.bytesIn = localStats.symbols;
+    localStats.bytesOut = (unsigned long long int)(fileOut.tellp() - outStart);
+    localStats.codingNs = huffman_elapsedNs(phaseStart);
+
+    if (stats)
+        *stats = localStats;
+}
+
+void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileName, HuffmanStats* stats)
+{
+    huffmanClock::time_point phaseStart = huffmanClock::now();
+    std::ofstream fileOut(compressedFileName, std::ios::binary);
+    unsigned long long int openNs = huffman_elapsedNs(phaseStart);
+
+    HuffmanStats localStats;
+    huffman_compressStream(fileIn, fileOut, &localStats);
+
+    phaseStart = huffmanClock::now();
     fileOut.close();
+    localStats.ioNs = openNs + huffman_elapsedNs(phaseStart);
+
+    if (stats)
+        *stats = localStats;
 }
 
 
@@ -333,52 +424,82 @@ HuffmanNode* huffman_rebuildHuffmanTree(Byte& byteStruct, HuffmanNode* node)
 
 unsigned long long int huffman_readSymbolsCountFromFile(Byte& byteStruct)
 {
-    //   ,       .
-    uint8_t symbolsBytesCount = 0;
+    //    ,     .
+    uint8_t symbolsBytesCount = (uint8_t)byteStruct.fileIn.get();
+    //     unsigned long long int,       8 
+    if (symbolsBytesCount > sizeof(unsigned long long int))
+        throw std::runtime_error(":    ");
     //       .
     unsigned long long int symbolsCount = 0;
 
-    //    ,     (255,  0xFF   ).
-    while ((byteStruct.byte = (uint8_t)byteStruct.fileIn.get()) != 255)
+    //    ,   .
+    for (uint8_t i = 0; i < symbolsBytesCount; i++)
     {
-        //    symbolsCount  8     .
-        //         symbolsCount.
-        symbolsCount = symbolsCount << (symbolsBytesCount * 8);
-        //     symbolsCount,   .
-        //        .
-        symbolsCount = symbolsCount | (unsigned long long int) byteStruct.byte;
-        //    .
-        symbolsBytesCount++;
+        //          .
+        symbolsCount = (symbolsCount << 8) | (unsigned long long int)(uint8_t)byteStruct.fileIn.get();
     }
 
+    //    (255).
+    byteStruct.byte = (uint8_t)byteStruct.fileIn.get();
+    if (byteStruct.fileIn.eof() || byteStruct.byte != 255)
+        throw std::runtime_error(":    ");
+
     //    .
     return symbolsCount;
 }
 
-void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFileName)
+void huffman_decompressStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats,
+    unsigned long long int expectedSymbols)
 {
+    huffmanClock::time_point phaseStart = huffmanClock::now();
+    HuffmanStats localStats;
+    std::streampos inStart = fileIn.tellg();
+
+    //       
+    if (fileIn.peek() == std::char_traits<char>::eof())
+    {
+        if (stats)
+            *stats = localStats;
+        return;
+    }
+
     //   Byte     .
     Byte byteStruct(fileIn);
     //     .
     byteStruct.byte = (uint8_t)fileIn.get();
 
-    //       .
-    std::ofstream fileOut;
-    fileOut.open(decompressedFileName, std::ios::binary);
-
     //      .
     HuffmanNode* huffmanTree = nullptr;
     huffmanTree = huffman_rebuildHuffmanTree(byteStruct, huffmanTree);
 
-    //        .
-    huffman_fileCursorPositionStart(fileIn);
-    //     (255),    .
-    while ((byteStruct.byte = (uint8_t)fileIn.get()) != 255);
+    //     .        ,
+    //  (255)   ;      byteStruct.byte.
+    //       :  255    .
+    if (byteStruct.bitsCount != 0)
+        byteStruct.byte = (uint8_t)fileIn.get();
+    if (byteStruct.byte != 255)
+    {
+        huffman_deleteTree(huffmanTree);
+        throw std::runtime_error(":    ");
+    }
 
     //    ,   .
-    bool flag = true;
     unsigned long long int symbolsRead = 0;
-    unsigned long long int symbolsCount = huffman_readSymbolsCountFromFile(byteStruct);
+    unsigned long long int symbolsCount = 0;
+    try
+    {
+        symbolsCount = huffman_readSymbolsCountFromFile(byteStruct);
+    }
+    catch (...)
+    {
+        huffman_deleteTree(huffmanTree);
+        throw;
+    }
+    if (expectedSymbols != HUFFMAN_ANY_SYMBOLS_COUNT && symbolsCount != expectedSymbols)
+    {
+        huffman_deleteTree(huffmanTree);
+        throw std::runtime_error(":    ");
+    }
 
     //      .
     HuffmanNode* currentNode = huffmanTree;
@@ -388,28 +509,35 @@ void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFi
         throw std::runtime_error(":   ");
     }
 
-    //     .
-    byteStruct.byte = (uint8_t)fileIn.get();
-    byteStruct.bitsCount = 0;
+    localStats.headerBytes = (unsigned long long int)(fileIn.tellg() - inStart);
+    localStats.headerNs = huffman_elapsedNs(phaseStart);
 
-    //   .
-    while (flag)
+    //   ,      
+    bool truncated = false;
+    if (huffman_nodeIsLeaf(currentNode))
     {
-        //    ...
-        if (byteStruct.bitsCount == 8)
-        {
-            //   .
-            byteStruct.byte = (uint8_t)fileIn.get();
-            byteStruct.bitsCount = 0;
+        //    :   ,      .
+        //  ,    .
+        for (; symbolsRead < symbolsCount && fileOut; symbolsRead++)
+            fileOut.put(huffman_getNodeChar(currentNode));
+    }
+    else
+    {
+        //     .
+        byteStruct.byte = (uint8_t)fileIn.get();
+        byteStruct.bitsCount = 0;
 
-            //    ,  .
+        //   :        .
+        // huffman_getBitFromByte        ,
+        //  eof ,   byteStruct.byte   .
+        while (symbolsRead < symbolsCount)
+        {
             if (fileIn.eof())
+            {
+                truncated = true;
                 break;
-        }
+            }
 
-        //     .
-        for (uint8_t i = 0; i < 8; i++)
-        {
             //          .
             if (huffman_getBitFromByte(byteStruct))
                 currentNode = huffman_getRightNode(currentNode);
@@ -425,19 +553,42 @@ void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFi
                 currentNode = huffmanTree;
                 //    .
                 symbolsRead++;
-
-                //     ,  .
-                if (symbolsRead == symbolsCount)
-                {
-                    flag = false;
-                    break;
-                }
             }
         }
     }
 
     //  ,    .
     huffmanTree = huffman_deleteTree(huffmanTree);
+    if (truncated)
+        throw std::runtime_error(":   ");
+    localStats.symbols = symbolsRead;
+    localStats.bytesOut = symbolsRead;
+    localStats.codingNs = huffman_elapsedNs(phaseStart);
+
+    //     :  ,  ,    .
+    fileIn.clear();
+    localStats.bytesIn = (unsigned long long int)(fileIn.tellg() - inStart);
+
+    if (stats)
+        *stats = localStats;
+}
+
+void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFileName, HuffmanStats* stats)
+{
+    huffmanClock::time_point phaseStart = huffmanClock::now();
+    //       .
+    std::ofstream fileOut;
+    fileOut.open(decompressedFileName, std::ios::binary);
+    unsigned long long int openNs = huffman_elapsedNs(phaseStart);
+
+    HuffmanStats localStats;
+    huffman_decompressStream(fileIn, fileOut, &localStats);
+
     //   .
+    phaseStart = huffmanClock::now();
     fileOut.close();
+    localStats.ioNs = openNs + huffman_elapsedNs(phaseStart);
+
+    if (stats)
+        *stats = localStats;
 }
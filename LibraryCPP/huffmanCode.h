@@ -2,9 +2,43 @@
 #define HUFFMANCODE_H
 
 #include <fstream>
+#include <iostream>
 
-void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileName);
+//   :       .
+//     ,     .
+struct HuffmanStats
+{
+    unsigned long long int histogramNs = 0;   //   
+    unsigned long long int treeBuildNs = 0;   //    
+    unsigned long long int tableBuildNs = 0;  //    (huffman_makeTable)
+    unsigned long long int headerNs = 0;      //     (   )
+    unsigned long long int codingNs = 0;      //     
+    unsigned long long int ioNs = 0;          //    ( )  
 
-void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFileName);
+    unsigned long long int bytesIn = 0;       //  
+    unsigned long long int bytesOut = 0;      //  
+    unsigned long long int headerBytes = 0;   //    
+    unsigned long long int symbols = 0;       //   
+    size_t alphabetSize = 0;                  //   
+    size_t maxCodeLength = 0;                 //     
+    double averageCodeLength = 0;             //       
+};
 
-#endif
\ No newline at end of file
+//      .
+//     ,    seekg (   ).
+void huffman_compressStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats = nullptr);
+
+//  expectedSymbols,        
+const unsigned long long int HUFFMAN_ANY_SYMBOLS_COUNT = ~0ull;
+
+//       (,   ),
+//    expectedSymbols:        
+//  .        std::runtime_error.
+void huffman_decompressStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats = nullptr,
+    unsigned long long int expectedSymbols = HUFFMAN_ANY_SYMBOLS_COUNT);
+
+void huffman_compress(std::ifstream& fileIn, const std::string& compressedFileName, HuffmanStats* stats = nullptr);
+
+void huffman_decompress(std::ifstream& fileIn, const std::string& decompressedFileName, HuffmanStats* stats = nullptr);
+
+#endif
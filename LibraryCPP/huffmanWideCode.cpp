@@ -0,0 +1,379 @@
+#include "huffmanWideCode.h"
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <cstdint>
+
+typedef std::chrono::steady_clock huffmanWideClock;
+
+const size_t HUFFMAN_WIDE_ALPHABET = 65536;
+const unsigned int HUFFMAN_WIDE_LOOKUP_BITS = 11; //         
+
+//  :        
+struct HuffmanWideTable
+{
+    std::vector<uint8_t> lengths;
+    std::vector<uint32_t> codes;
+    HuffmanWideTable() : lengths(HUFFMAN_WIDE_ALPHABET, 0), codes(HUFFMAN_WIDE_ALPHABET, 0) { }
+};
+
+unsigned long long int huffmanWide_elapsedNs(huffmanWideClock::time_point& phaseStart)
+{
+    huffmanWideClock::time_point now = huffmanWideClock::now();
+    unsigned long long int elapsed = (unsigned long long int)std::chrono::duration_cast<std::chrono::nanoseconds>(now - phaseStart).count();
+    phaseStart = now;
+    return elapsed;
+}
+
+void huffmanWide_writeVarint(std::string& out, unsigned long long int value)
+{
+    //  7   ,   ,   
+    while (value >= 0x80)
+    {
+        out.push_back((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+unsigned long long int huffmanWide_readVarint(const std::string& in, size_t& pos)
+{
+    unsigned long long int value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (pos >= in.size())
+            throw std::runtime_error(":    ");
+        uint8_t byte = (uint8_t)in[pos++];
+        value |= (unsigned long long int)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+    throw std::runtime_error(":    ");
+}
+
+//    ,   .
+//       ,    :
+//       ,        O(n).
+void huffmanWide_computeLengths(const std::vector<unsigned long long int>& weights, std::vector<uint8_t>& lengths)
+{
+    size_t count = weights.size();
+    lengths.assign(count, 0);
+    if (count == 1)
+    {
+        //       ,       
+        lengths[0] = 1;
+        return;
+    }
+
+    std::vector<unsigned long long int> nodeWeight(2 * count - 1);
+    std::vector<size_t> parent(2 * count - 1, 0);
+    std::copy(weights.begin(), weights.end(), nodeWeight.begin());
+
+    size_t leafPos = 0;       //   
+    size_t nodePos = count;   //    
+    size_t nextNode = count;  //     
+    auto takeMin = [&]() -> size_t {
+        if (leafPos < count && (nodePos >= nextNode || nodeWeight[leafPos] <= nodeWeight[nodePos]))
+            return leafPos++;
+        return nodePos++;
+    };
+
+    for (; nextNode < 2 * count - 1; nextNode++)
+    {
+        size_t left = takeMin();
+        size_t right = takeMin();
+        nodeWeight[nextNode] = nodeWeight[left] + nodeWeight[right];
+        parent[left] = nextNode;
+        parent[right] = nextNode;
+    }
+
+    //       ;     
+    std::vector<uint8_t> depth(2 * count - 1, 0);
+    for (size_t i = 2 * count - 2; i-- > 0;)
+    {
+        unsigned int nodeDepth = depth[parent[i]] + 1u;
+        depth[i] = (uint8_t)std::min(nodeDepth, 255u);
+    }
+    std::copy(depth.begin(), depth.begin() + count, lengths.begin());
+}
+
+//     .      .
+std::vector<uint16_t> huffmanWide_buildTable(const std::vector<unsigned long long int>& histogram, HuffmanWideTable& table)
+{
+    std::vector<uint16_t> symbols;
+    for (size_t i = 0; i < HUFFMAN_WIDE_ALPHABET; i++)
+        if (histogram[i])
+            symbols.push_back((uint16_t)i);
+    if (symbols.empty())
+        return symbols;
+
+    //    ,    -  
+    std::vector<uint16_t> byWeight(symbols);
+    std::sort(byWeight.begin(), byWeight.end(), [&](uint16_t a, uint16_t b) {
+        return histogram[a] != histogram[b] ? histogram[a] < histogram[b] : a < b;
+    });
+    std::vector<unsigned long long int> weights(byWeight.size());
+    for (size_t i = 0; i < byWeight.size(); i++)
+        weights[i] = histogram[byWeight[i]];
+
+    //     ,      .
+    //      ,       1   .
+    std::vector<uint8_t> lengths;
+    while (true)
+    {
+        huffmanWide_computeLengths(weights, lengths);
+        if (*std::max_element(lengths.begin(), lengths.end()) <= HUFFMAN_WIDE_MAX_CODE_LENGTH)
+            break;
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = (weights[i] >> 1) | 1;
+    }
+    for (size_t i = 0; i < byWeight.size(); i++)
+        table.lengths[byWeight[i]] = lengths[i];
+
+    //  :     ,    
+    std::vector<uint16_t> canonical(symbols);
+    std::stable_sort(canonical.begin(), canonical.end(), [&](uint16_t a, uint16_t b) {
+        return table.lengths[a] < table.lengths[b];
+    });
+    uint32_t code = 0;
+    unsigned int previousLength = table.lengths[canonical[0]];
+    for (size_t i = 0; i < canonical.size(); i++)
+    {
+        unsigned int length = table.lengths[canonical[i]];
+        code <<= (length - previousLength);
+        previousLength = length;
+        table.codes[canonical[i]] = code++;
+    }
+    return symbols;
+}
+
+void huffman_compressWideStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats)
+{
+    huffmanWideClock::time_point phaseStart = huffmanWideClock::now();
+    HuffmanStats localStats;
+
+    std::string data((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+    localStats.bytesIn = data.size();
+    if (data.empty())
+    {
+        if (stats)
+            *stats = localStats;
+        return;
+    }
+
+    size_t symbolsTotal = data.size() / 2;
+    std::vector<unsigned long long int> histogram(HUFFMAN_WIDE_ALPHABET, 0);
+    for (size_t i = 0; i < symbolsTotal; i++)
+        histogram[(uint8_t)data[2 * i] | ((size_t)(uint8_t)data[2 * i + 1] << 8)]++;
+    localStats.symbols = symbolsTotal;
+    localStats.histogramNs = huffmanWide_elapsedNs(phaseStart);
+
+    HuffmanWideTable table;
+    std::vector<uint16_t> symbols = huffmanWide_buildTable(histogram, table);
+    localStats.alphabetSize = symbols.size();
+    localStats.treeBuildNs = huffmanWide_elapsedNs(phaseStart);
+
+    unsigned long long int totalBits = 0;
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        localStats.maxCodeLength = std::max(localStats.maxCodeLength, (size_t)table.lengths[symbols[i]]);
+        totalBits += histogram[symbols[i]] * table.lengths[symbols[i]];
+    }
+    localStats.averageCodeLength = symbolsTotal ? (double)totalBits / (double)symbolsTotal : 0;
+    localStats.tableBuildNs = huffmanWide_elapsedNs(phaseStart);
+
+    // :      ,  ,    
+    std::string out;
+    out.reserve((size_t)(totalBits / 8) + symbols.size() * 2 + 32);
+    bool odd = data.size() % 2 != 0;
+    out.push_back((char)(odd ? 1 : 0));
+    if (odd)
+        out.push_back(data.back());
+    huffmanWide_writeVarint(out, symbolsTotal);
+    huffmanWide_writeVarint(out, symbols.size());
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        //    ,     
+        huffmanWide_writeVarint(out, i ? symbols[i] - symbols[i - 1] - 1u : symbols[i]);
+        out.push_back((char)table.lengths[symbols[i]]);
+    }
+    localStats.headerBytes = out.size();
+    localStats.headerNs = huffmanWide_elapsedNs(phaseStart);
+
+    //     64-     ,   
+    unsigned long long int bitBuffer = 0;
+    unsigned int bitCount = 0;
+    for (size_t i = 0; i < symbolsTotal; i++)
+    {
+        size_t symbol = (uint8_t)data[2 * i] | ((size_t)(uint8_t)data[2 * i + 1] << 8);
+        bitBuffer = (bitBuffer << table.lengths[symbol]) | table.codes[symbol];
+        bitCount += table.lengths[symbol];
+        while (bitCount >= 8)
+        {
+            bitCount -= 8;
+            out.push_back((char)(bitBuffer >> bitCount));
+        }
+    }
+    if (bitCount)
+        out.push_back((char)(bitBuffer << (8 - bitCount)));
+    fileOut.write(out.data(), (std::streamsize)out.size());
+    localStats.bytesOut = out.size();
+    localStats.codingNs = huffmanWide_elapsedNs(phaseStart);
+
+    if (stats)
+        *stats = localStats;
+}
+
+void huffman_decompressWideStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats)
+{
+    huffmanWideClock::time_point phaseStart = huffmanWideClock::now();
+    HuffmanStats localStats;
+
+    std::string in((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+    localStats.bytesIn = in.size();
+    if (in.empty())
+    {
+        if (stats)
+            *stats = localStats;
+        return;
+    }
+
+    size_t pos = 0;
+    bool odd = (in[pos++] & 1) != 0;
+    char lastByte = 0;
+    if (odd)
+    {
+        if (pos >= in.size())
+            throw std::runtime_error(":    ");
+        lastByte = in[pos++];
+    }
+    unsigned long long int symbolsTotal = huffmanWide_readVarint(in, pos);
+    unsigned long long int alphabetSize = huffmanWide_readVarint(in, pos);
+    if (alphabetSize > HUFFMAN_WIDE_ALPHABET || (symbolsTotal && !alphabetSize))
+        throw std::runtime_error(":    ");
+
+    //     ,    
+    std::vector<uint16_t> symbols((size_t)alphabetSize);
+    std::vector<uint8_t> lengths((size_t)alphabetSize);
+    size_t lengthCount[HUFFMAN_WIDE_MAX_CODE_LENGTH + 1] = { 0 };
+    unsigned long long int symbol = 0;
+    for (size_t i = 0; i < symbols.size(); i++)
+    {
+        symbol = i ? symbol + huffmanWide_readVarint(in, pos) + 1 : huffmanWide_readVarint(in, pos);
+        if (symbol >= HUFFMAN_WIDE_ALPHABET || pos >= in.size())
+            throw std::runtime_error(":    ");
+        symbols[i] = (uint16_t)symbol;
+        lengths[i] = (uint8_t)in[pos++];
+        if (lengths[i] == 0 || lengths[i] > HUFFMAN_WIDE_MAX_CODE_LENGTH)
+            throw std::runtime_error(":    ");
+        lengthCount[lengths[i]]++;
+        localStats.maxCodeLength = std::max(localStats.maxCodeLength, (size_t)lengths[i]);
+    }
+    //       ,    ,   
+    if (symbolsTotal > (unsigned long long int)(in.size() - pos) * 8)
+        throw std::runtime_error(":    ");
+    localStats.alphabetSize = symbols.size();
+    localStats.headerBytes = pos;
+    localStats.headerNs = huffmanWide_elapsedNs(phaseStart);
+
+    //         
+    std::vector<uint16_t> canonical(symbols.size());
+    size_t offset[HUFFMAN_WIDE_MAX_CODE_LENGTH + 2] = { 0 };
+    for (unsigned int length = 1; length <= HUFFMAN_WIDE_MAX_CODE_LENGTH; length++)
+        offset[length + 1] = offset[length] + lengthCount[length];
+    {
+        size_t next[HUFFMAN_WIDE_MAX_CODE_LENGTH + 2];
+        std::copy(offset, offset + HUFFMAN_WIDE_MAX_CODE_LENGTH + 2, next);
+        for (size_t i = 0; i < symbols.size(); i++)
+            canonical[next[lengths[i]]++] = symbols[i];
+    }
+
+    //   :   LOOKUP_BITS        .
+    //       .
+    std::vector<uint16_t> lookupSymbol((size_t)1 << HUFFMAN_WIDE_LOOKUP_BITS, 0);
+    std::vector<uint8_t> lookupLength((size_t)1 << HUFFMAN_WIDE_LOOKUP_BITS, 0);
+    {
+        uint32_t code = 0;
+        size_t index = 0;
+        for (unsigned int length = 1; length <= HUFFMAN_WIDE_LOOKUP_BITS; length++)
+        {
+            for (size_t i = 0; i < lengthCount[length]; i++, index++, code++)
+            {
+                size_t first = (size_t)code << (HUFFMAN_WIDE_LOOKUP_BITS - length);
+                size_t last = first + ((size_t)1 << (HUFFMAN_WIDE_LOOKUP_BITS - length));
+                for (size_t j = first; j < last && j < lookupSymbol.size(); j++)
+                {
+                    lookupSymbol[j] = canonical[index];
+                    lookupLength[j] = (uint8_t)length;
+                }
+            }
+            code <<= 1;
+        }
+    }
+    localStats.tableBuildNs = huffmanWide_elapsedNs(phaseStart);
+
+    //  :   ;     
+    std::string out;
+    out.reserve((size_t)symbolsTotal * 2 + 1);
+    unsigned long long int bitBuffer = 0;
+    unsigned int bitCount = 0;
+    auto refill = [&]() {
+        while (bitCount <= 56)
+        {
+            uint8_t byte = pos < in.size() ? (uint8_t)in[pos] : 0;
+            pos++;
+            bitBuffer |= (unsigned long long int)byte << (56 - bitCount);
+            bitCount += 8;
+        }
+    };
+
+    for (unsigned long long int decoded = 0; decoded < symbolsTotal; decoded++)
+    {
+        refill();
+        size_t peek = (size_t)(bitBuffer >> (64 - HUFFMAN_WIDE_LOOKUP_BITS));
+        uint16_t value = 0;
+        unsigned int length = lookupLength[peek];
+        if (length)
+            value = lookupSymbol[peek];
+        else
+        {
+            //  :   ,    
+            uint32_t code = 0;
+            uint32_t first = 0;
+            size_t index = 0;
+            for (length = 1; ; length++)
+            {
+                if (length > HUFFMAN_WIDE_MAX_CODE_LENGTH)
+                    throw std::runtime_error(":    ");
+                code |= (uint32_t)(bitBuffer >> (64 - length)) & 1;
+                if (code - first < lengthCount[length])
+                {
+                    value = canonical[index + (code - first)];
+                    break;
+                }
+                index += lengthCount[length];
+                first = (first + (uint32_t)lengthCount[length]) << 1;
+                code <<= 1;
+            }
+        }
+        bitBuffer <<= length;
+        bitCount -= length;
+        out.push_back((char)(value & 0xFF));
+        out.push_back((char)(value >> 8));
+    }
+    if (odd)
+        out.push_back(lastByte);
+    //      ,     
+    if ((unsigned long long int)pos * 8 - bitCount > (unsigned long long int)in.size() * 8)
+        throw std::runtime_error(":    ");
+    localStats.symbols = symbolsTotal;
+    localStats.bytesOut = out.size();
+    fileOut.write(out.data(), (std::streamsize)out.size());
+    localStats.codingNs = huffmanWide_elapsedNs(phaseStart);
+
+    if (stats)
+        *stats = localStats;
+}
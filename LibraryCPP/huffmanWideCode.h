@@ -0,0 +1,19 @@
+#ifndef HUFFMANWIDECODE_H
+#define HUFFMANWIDECODE_H
+
+#include <iostream>
+#include "huffmanCode.h"
+
+//    16-  ( ,   ).
+//   65536 :    O(n)   ,
+//  ,       .
+//     ,      .
+
+//   :      
+const unsigned int HUFFMAN_WIDE_MAX_CODE_LENGTH = 20;
+
+void huffman_compressWideStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats = nullptr);
+
+void huffman_decompressWideStream(std::istream& fileIn, std::ostream& fileOut, HuffmanStats* stats = nullptr);
+
+#endif
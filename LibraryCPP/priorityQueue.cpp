@@ -1,44 +1,144 @@
 #include "priorityQueue.h"
+#include <stdexcept>
+#include "../LibraryCPPTemplate/binaryHeap.h"
 
+//     ,    BinaryHeap  binaryHeap.cpp: -DBINARYHEAP_ARITY=4
+#ifndef BINARYHEAP_ARITY
+#define BINARYHEAP_ARITY 2
+#endif
+
+// -       
+struct ComparatorAdapter
+{
+    Comparator compare;
+
+    bool operator()(void* a, void* b) const
+    {
+        return compare(a, b) < 0;
+    }
+};
+
+//        :     ,
+//      ,      
 struct PriorityQueue
 {
-    BinaryHeap* heap;
+    ::BinaryHeap<void*, ComparatorAdapter, BINARYHEAP_ARITY> heap;
+    Destructor destroy;    // -  ,   
+    size_t memoryLimit;    //  ,   (0 -  )
+
+    PriorityQueue(Comparator comp, Destructor dest) : heap(ComparatorAdapter{ comp }), destroy(dest), memoryLimit(0) { }
 };
 
+//  ,   
+static size_t priorityQueue_maxCapacity(PriorityQueue* queue)
+{
+    return queue->memoryLimit ? queue->memoryLimit / sizeof(void*) : (size_t)-1 / sizeof(void*);
+}
+
 PriorityQueue* priorityQueue_create(const size_t size, Comparator comp, Destructor dest)
 {
-    PriorityQueue* queue = new PriorityQueue;
-    queue->heap = binaryHeap_create(size, comp, dest);
+    PriorityQueue* queue = new PriorityQueue(comp, dest);
+    queue->heap.reserve(size);
+    return queue;
+}
+
+PriorityQueue* priorityQueue_createFrom(void** data, const size_t count, Comparator comp, Destructor dest)
+{
+    PriorityQueue* queue = new PriorityQueue(comp, dest);
+    queue->heap.reserve(count);
+    queue->heap.insertMany(data, data + count);
     return queue;
 }
 
 void priorityQueue_delete(PriorityQueue* queue)
 {
-    binaryHeap_delete(queue->heap);
+    while (!queue->heap.empty())
+        queue->destroy(queue->heap.extractMin());
     delete queue;
 }
 
-void priorityQueue_insert(PriorityQueue* queue, void* data)
+bool priorityQueue_insert(PriorityQueue* queue, void* data)
+{
+    try
+    {
+        queue->heap.insert(data);
+    }
+    catch (const std::length_error&)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool priorityQueue_insertMany(PriorityQueue* queue, void** data, const size_t count)
 {
-    binaryHeap_insert(queue->heap, data);
+    //         ,
+    //       
+    size_t maxCapacity = priorityQueue_maxCapacity(queue);
+    size_t size = queue->heap.size();
+    if (count > maxCapacity - size)
+        return false;
+    size_t required = size + count;
+    size_t capacity = queue->heap.getCapacity();
+    if (required > capacity)
+    {
+        size_t newCapacity = capacity * 2 > required ? capacity * 2 : required;
+        queue->heap.reserve(newCapacity < maxCapacity ? newCapacity : maxCapacity);
+    }
+    queue->heap.insertMany(data, data + count);
+    return true;
 }
 
 void* priorityQueue_getMin(PriorityQueue* queue)
 {
-    return binaryHeap_getMin(queue->heap);
+    return queue->heap.empty() ? NULL : queue->heap.getMin();
 }
 
 void* priorityQueue_extractMin(PriorityQueue* queue)
 {
-    return binaryHeap_extractMin(queue->heap);
+    return queue->heap.empty() ? NULL : queue->heap.extractMin();
+}
+
+size_t priorityQueue_extractMany(PriorityQueue* queue, void** out, const size_t count)
+{
+    return queue->heap.extractMany(count, out);
 }
 
 size_t priorityQueue_getSize(PriorityQueue* queue)
 {
-    return binaryHeap_getSize(queue->heap);
+    return queue->heap.size();
 }
 
 bool priorityQueue_empty(PriorityQueue* queue)
 {
-    return binaryHeap_getSize(queue->heap) == 0;
+    return queue->heap.empty();
+}
+
+size_t priorityQueue_getCapacity(PriorityQueue* queue)
+{
+    return queue->heap.getCapacity();
+}
+
+bool priorityQueue_reserve(PriorityQueue* queue, const size_t size)
+{
+    try
+    {
+        queue->heap.reserve(size);
+    }
+    catch (const std::length_error&)
+    {
+        return false;
+    }
+    return true;
+}
+
+void priorityQueue_shrinkToFit(PriorityQueue* queue)
+{
+    queue->heap.shrink_to_fit();
+}
+
+void priorityQueue_setMemoryLimit(PriorityQueue* queue, const size_t bytes)
+{
+    queue->memoryLimit = bytes;
+    queue->heap.setMemoryLimit(bytes);
 }
\ No newline at end of file
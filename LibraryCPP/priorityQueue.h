@@ -1,22 +1,47 @@
 #ifndef PRIORITYQUEUE_H
 #define PRIORITYQUEUE_H
 
-#include "binaryHeap.h"
+#include <stdlib.h>
+
+//   ,    binaryHeap.h.       LibraryCPPTemplate
+//    binaryHeap.h:    BinaryHeap
+typedef int (*Comparator)(const void*, const void*);
+typedef void (*Destructor)(void*);
 
 struct PriorityQueue;
 
+// size -  ,      
 PriorityQueue* priorityQueue_create(const size_t size, Comparator comp, Destructor dest);
 
+//     count   O(n)  ( data   )
+PriorityQueue* priorityQueue_createFrom(void** data, const size_t count, Comparator comp, Destructor dest);
+
 void priorityQueue_delete(PriorityQueue* queue);
 
-void priorityQueue_insert(PriorityQueue* queue, void* data);
+//  false,       
+bool priorityQueue_insert(PriorityQueue* queue, void* data);
+
+//  count  ; false,       
+bool priorityQueue_insertMany(PriorityQueue* queue, void** data, const size_t count);
 
 void* priorityQueue_getMin(PriorityQueue* queue);
 
 void* priorityQueue_extractMin(PriorityQueue* queue);
 
+//   count      out;   
+size_t priorityQueue_extractMany(PriorityQueue* queue, void** out, const size_t count);
+
 size_t priorityQueue_getSize(PriorityQueue* queue);
 
 bool priorityQueue_empty(PriorityQueue* queue);
 
+size_t priorityQueue_getCapacity(PriorityQueue* queue);
+
+bool priorityQueue_reserve(PriorityQueue* queue, const size_t size);
+
+void priorityQueue_shrinkToFit(PriorityQueue* queue);
+
+//       , 0 -  
+void priorityQueue_setMemoryLimit(PriorityQueue* queue, const size_t bytes);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstdlib>
+#include "arenaHashTable.h"
+#include "hashTableTests.h"
+
+int main() {
+    srand(1);
+
+    ArenaHashTable<> words;
+    if (!randomCompare(words, 300000, 20000, stringKey, stringValue)) {
+        std::cout << "Table differs from unordered_map\n";
+        return 1;
+    }
+
+    //    ,    
+    ArenaHashTable<> special;
+    std::string large(StringArena::BLOCK_SIZE * 3 / 2, 'x');
+    special.add("", "");
+    special.add("large", large);
+    special.add("after", "value");
+    if (special.find("").first != true || !special.find("").second.empty()
+        || special.find("large").second != large || special.find("after").second != "value") {
+        std::cout << "Special strings error\n";
+        return 1;
+    }
+
+    //   -  :     
+    special.add("overlap", "0123456789");
+    special.add("overlap", special.find("overlap").second.substr(3));
+    special.add("overlap", special.find("overlap").second.substr(0, 4));
+    if (special.find("overlap").second != "3456") {
+        std::cout << "Overlapping value error\n";
+        return 1;
+    }
+
+    //    :    ,     
+    const size_t LIVE = 10000;
+    ArenaHashTable<> sessions;
+    for (size_t i = 0; i < LIVE * 100; i++) {
+        sessions.add("session" + std::to_string(i % LIVE), "payload" + std::to_string(i));
+        if (i % 7 == 0) {
+            sessions.del("session" + std::to_string((i + LIVE / 2) % LIVE));
+        }
+    }
+    if (sessions.get_arena_size() > 8 * StringArena::BLOCK_SIZE) {
+        std::cout << "Arena was not compacted: " << sessions.get_arena_size() << "\n";
+        return 1;
+    }
+    for (size_t i = LIVE * 99; i < LIVE * 100; i++) {
+        std::pair<bool, std::string_view> result = sessions.find("session" + std::to_string(i % LIVE));
+        if (result.first && result.second != "payload" + std::to_string(i)) {
+            std::cout << "Value was lost after compaction\n";
+            return 1;
+        }
+    }
+
+    //     :      
+    ArenaHashTable<ConstantHash<3>> collisions;
+    if (!collisionCompare(collisions, 300, stringKey, stringValue)) {
+        std::cout << "Collision handling error\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+#include <iterator>
+#include "binaryHeap.h"
+
+typedef BinaryHeap<int> MyHeap;
+
+//    ,    
+struct PointerLess {
+    bool operator()(const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) const {
+        return *a < *b;
+    }
+};
+
+//         d- 
+template <size_t Arity>
+bool testDaryHeap() {
+    DaryHeap<int, Arity> heap;
+    std::vector<int> values;
+    for (int i = 0; i < 50000; i++) {
+        int value = rand() % 10000;
+        values.push_back(value);
+        heap.insert(value);
+    }
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); i++) {
+        if (heap.getMin() != values[i]) {
+            return false;
+        }
+        heap.removeMin();
+        if (i % 3 == 0) {
+            heap.insert(values[i]);
+            if (heap.extractMin() != values[i]) {
+                return false;
+            }
+        }
+    }
+    return heap.empty();
+}
+
+int main() {
+    MyHeap heap;
+    std::vector<int> values;
+
+    srand(1);
+    for (int i = 0; i < 100000; i++) {
+        int value = rand() % 1000;
+        values.push_back(value);
+        heap.insert(value);
+    }
+    if (heap.size() != values.size()) {
+        std::cout << "Invalid heap size\n";
+        return 1;
+    }
+
+    //     
+    MyHeap copy = heap;
+
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < values.size(); i++) {
+        if (heap.getMin() != values[i] || heap.extractMin() != values[i]) {
+            std::cout << "Invalid extraction order\n";
+            return 1;
+        }
+    }
+    if (!heap.empty()) {
+        std::cout << "Heap should be empty\n";
+        return 1;
+    }
+
+    if (copy.size() != values.size() || copy.getMin() != values[0]) {
+        std::cout << "Invalid heap copy\n";
+        return 1;
+    }
+
+    //      
+    try {
+        heap.extractMin();
+        std::cout << "Extraction from empty heap must throw\n";
+        return 1;
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    //      ,   
+    BinaryHeap<std::unique_ptr<int>, PointerLess> pointers;
+    for (int i = 0; i < 1000; i++) {
+        pointers.insert(std::unique_ptr<int>(new int((i * 7919) % 1000)));
+    }
+    for (int i = 0; i < 1000; i++) {
+        std::unique_ptr<int> top = pointers.extractMin();
+        if (*top != i) {
+            std::cout << "Invalid move-only extraction order\n";
+            return 1;
+        }
+    }
+
+    // ,      
+    BinaryHeap<long long> limited;
+    limited.reserve(1000);
+    if (limited.getCapacity() < 1000) {
+        std::cout << "Invalid reserve\n";
+        return 1;
+    }
+    for (long long i = 0; i < 10; i++) {
+        limited.insert(i);
+    }
+    limited.shrink_to_fit();
+    if (limited.getCapacity() != 10 || limited.getMin() != 0) {
+        std::cout << "Invalid shrink_to_fit\n";
+        return 1;
+    }
+    limited.setMemoryLimit(64 * sizeof(long long));
+    try {
+        for (long long i = 0; i < 100; i++) {
+            limited.insert(i);
+        }
+        std::cout << "Memory limit must be enforced\n";
+        return 1;
+    }
+    catch (const std::length_error&) {
+    }
+    if (limited.size() != 64 || limited.getCapacity() != 64) {
+        std::cout << "Heap must be filled up to the memory limit\n";
+        return 1;
+    }
+
+    // 3-, 4-  8- 
+    if (!testDaryHeap<3>() || !testDaryHeap<4>() || !testDaryHeap<8>()) {
+        std::cout << "Invalid d-ary heap order\n";
+        return 1;
+    }
+
+    //   ,    
+    std::vector<int> bulk;
+    for (int i = 0; i < 10000; i++) {
+        bulk.push_back((i * 7919) % 10000);
+    }
+    MyHeap built(bulk.begin(), bulk.begin() + 5000);
+    built.insertMany(bulk.begin() + 5000, bulk.begin() + 9900);
+    built.insertMany(bulk.begin() + 9900, bulk.end());
+    std::vector<int> sorted;
+    if (built.size() != bulk.size() || built.extractMany(bulk.size() + 10, std::back_inserter(sorted)) != bulk.size()) {
+        std::cout << "Invalid bulk sizes\n";
+        return 1;
+    }
+    for (int i = 0; i < 10000; i++) {
+        if (sorted[i] != i) {
+            std::cout << "Invalid bulk extraction order\n";
+            return 1;
+        }
+    }
+
+    BinaryHeap<std::string, std::greater<std::string>> strings;
+    strings.emplace("b");
+    strings.emplace(3, 'a');
+    strings.insert(std::string("c"));
+    if (strings.extractMin() != "c" || strings.extractMin() != "b" || strings.extractMin() != "aaa") {
+        std::cout << "Invalid max-heap order\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include "concurrentHashTable.h"
+
+//   xorshift      
+uint64_t nextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+// -,   
+struct CountingHash {
+    std::atomic<size_t>* calls;
+
+    size_t operator()(uint64_t key) const {
+        (*calls)++;
+        return (size_t)(key * 0x9E3779B97F4A7C15ull);
+    }
+};
+
+int main() {
+    //            std::unordered_map,
+    //         
+    const size_t threads = 8;
+    ConcurrentHashTable<std::string, std::string> table(4);
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&table, &failed, t]() {
+            uint64_t state = t * 0x9E3779B97F4A7C15ull + 1;
+            std::unordered_map<std::string, std::string> reference;
+            for (size_t i = 0; i < 20000; i++) {
+                uint64_t random = nextRandom(state);
+                std::string own = std::to_string(t) + "/" + std::to_string(random % 500);
+                std::string shared = "shared" + std::to_string(random % 50);
+                switch (random >> 60) {
+                case 0: case 1: case 2:
+                    table.add(own, own + std::to_string(i));
+                    reference[own] = own + std::to_string(i);
+                    break;
+                case 3: case 4:
+                    table.del(own);
+                    reference.erase(own);
+                    break;
+                case 5:
+                    //         -     
+                    table.add(shared, shared + "value");
+                    break;
+                case 6:
+                    table.del(shared);
+                    break;
+                default: {
+                    std::pair<bool, std::string> result = table.find(own);
+                    auto it = reference.find(own);
+                    if (result.first != (it != reference.end()) || (result.first && result.second != it->second)) {
+                        failed = true;
+                    }
+                    result = table.find(shared);
+                    if (result.first && result.second != shared + "value") {
+                        failed = true;
+                    }
+                }
+                }
+            }
+            for (auto it = reference.begin(); it != reference.end(); ++it) {
+                std::pair<bool, std::string> result = table.find(it->first);
+                if (!result.first || result.second != it->second) {
+                    failed = true;
+                }
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads; t++) {
+        workers[t].join();
+    }
+    if (failed) {
+        std::cout << "Concurrent operations error\n";
+        return 1;
+    }
+
+    //         
+    size_t found = 0;
+    for (size_t t = 0; t < threads; t++) {
+        for (size_t k = 0; k < 500; k++) {
+            found += table.find(std::to_string(t) + "/" + std::to_string(k)).first;
+        }
+    }
+    for (size_t k = 0; k < 50; k++) {
+        found += table.find("shared" + std::to_string(k)).first;
+    }
+    if (table.get_size() != found) {
+        std::cout << "Invalid size after concurrent operations\n";
+        return 1;
+    }
+
+    //      : ,  ,    .
+    //   ,          
+    std::atomic<size_t> calls(0);
+    CountingHash counting = { &calls };
+    ConcurrentHashTable<uint64_t, uint64_t, CountingHash> counted(4, counting);
+    for (uint64_t k = 0; k < 1000; k++) {
+        counted.add(k, k);
+    }
+    calls = 0;
+    for (uint64_t k = 0; k < 1000; k++) {
+        counted.add(k, k + 1);
+        counted.find(k);
+        counted.del(k);
+    }
+    if (calls != 3000 || counted.get_size() != 0) {
+        std::cout << "Key was hashed more than once per operation: " << calls << " calls\n";
+        return 1;
+    }
+
+    return 0;
+}
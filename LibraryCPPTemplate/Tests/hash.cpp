@@ -1,15 +1,51 @@
+#include <cstdint>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+#include <new>
 #include <stdio.h>
 #include "array.h"
 #include "hash.h"
 
 using namespace std;
 
+//counting heap allocations to check that lookups don't allocate
+static size_t allocations = 0;
+
+void* operator new(size_t size) {
+	allocations++;
+	void* result = malloc(size ? size : 1);
+	if (!result) throw bad_alloc();
+	return result;
+}
+
+//replaced operator new is malloc, so free is the matching deallocation
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* pointer) noexcept {
+	free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	free(pointer);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+//degenerate hash: a key is its own hash, so the probe sequence is chosen by the test
+struct IdentityHash {
+	size_t operator()(uint64_t key) const { return (size_t)key; }
+};
+
 int main() {
 	setlocale(LC_ALL, "rus");
 
-	HashTable* table = new HashTable();
+	HashTable<string, string>* table = new HashTable<string, string>();
 
 	size_t size_for_tests = 500000; //performance
 
@@ -38,5 +74,208 @@ int main() {
 	}
 
 	delete table;
+
+	//integer keys
+	HashTable<uint64_t, uint64_t> ids;
+	for (uint64_t i = 0; i < size_for_tests; i++) ids.add(i * 1000003, i);
+	for (uint64_t i = 0; i < size_for_tests; i += 2) ids.del(i * 1000003);
+	if (ids.get_size() != size_for_tests / 2) {
+		cout << "Integer table size error\n";
+		return 1;
+	}
+	for (uint64_t i = 0; i < size_for_tests; i++)
+	{
+		auto result = ids.find(i * 1000003);
+		if (result.first != (i % 2 == 1) || (result.first && result.second != i)) {
+			cout << "Integer search error\n";
+			return 1;
+		}
+	}
+
+	//overwrite and re-adding after removal
+	ids.add(1000003, 7);
+	ids.add(0, 8);
+	if (ids.get_size() != size_for_tests / 2 + 1 || ids.find(1000003).second != 7 || ids.find(0).second != 8) {
+		cout << "Integer overwrite error\n";
+		return 1;
+	}
+
+	//empty string is an ordinary key
+	HashTable<string, string> words;
+	words.add("", "empty");
+	words.add("key", "value");
+	words.del("key");
+	HashTable<string, string> copy = words;
+	if (!copy.find("").first || copy.find("").second != "empty" || copy.find("key").first || copy.get_size() != 1) {
+		cout << "Empty key or copy error\n";
+		return 1;
+	}
+
+	//incremental resize: lookups, updates and removals while both arrays are in use
+	HashTable<uint64_t, uint64_t> incremental;
+	incremental.set_incremental_resize(true);
+	uint64_t added = 0;
+	bool was_resizing = false;
+	for (int round = 0; round < 5; round++) {
+		while (!incremental.is_resizing()) {
+			incremental.add(added, added);
+			added++;
+		}
+		was_resizing = true;
+		incremental.add(0, 100);
+		incremental.del(1);
+		HashTable<uint64_t, uint64_t> snapshot = incremental;
+		for (uint64_t i = 0; i < added; i++)
+		{
+			auto result = snapshot.find(i);
+			uint64_t expected = i == 0 ? 100 : i;
+			if (result.first != (i != 1) || (result.first && result.second != expected)) {
+				cout << "Incremental resize search error\n";
+				return 1;
+			}
+		}
+		incremental.add(1, 1);
+		incremental.add(0, 0);
+		while (incremental.is_resizing()) {
+			incremental.add(added, added);
+			added++;
+		}
+	}
+	if (!was_resizing || incremental.get_size() != added) {
+		cout << "Incremental resize size error\n";
+		return 1;
+	}
+	while (!incremental.is_resizing()) {
+		incremental.add(added, added);
+		added++;
+	}
+	//switching the mode off finishes the migration at once
+	incremental.set_incremental_resize(false);
+	if (incremental.is_resizing()) {
+		cout << "Migration wasn't finished\n";
+		return 1;
+	}
+	for (uint64_t i = 0; i < added; i++)
+	{
+		auto result = incremental.find(i);
+		if (!result.first || result.second != i) {
+			cout << "Incremental resize lost an element\n";
+			return 1;
+		}
+	}
+
+	//old array without empty cells among the cells not yet migrated: lookups of missing keys
+	//must stop after visiting every remaining cell instead of probing forever
+	HashTable<uint64_t, uint64_t, IdentityHash> crowded;
+	crowded.set_incremental_resize(true);
+	for (uint64_t i = 192; i < 256; i++) crowded.add(i, i);
+	for (uint64_t i = 0; i < 63; i++) crowded.add(i, i);
+	for (uint64_t i = 1000; i < 1004; i++) crowded.add(i, i);
+	if (!crowded.is_resizing() || crowded.find(5000).first || crowded.find_value((uint64_t)100) != nullptr) {
+		cout << "Crowded old array search error\n";
+		return 1;
+	}
+	uint64_t crowded_keys[] = { 100, 200, 1003, 7 };
+	const uint64_t* crowded_results[4];
+	if (crowded.find_many(crowded_keys, 4, crowded_results) != 3 || crowded_results[0] != nullptr) {
+		cout << "Crowded old array batched search error\n";
+		return 1;
+	}
+	crowded.del(5000);
+	while (crowded.is_resizing()) crowded.add(crowded.get_size() + 2000, 0);
+	for (uint64_t i = 0; i < 256; i++) {
+		if (crowded.find(i).first != (i < 63 || i >= 192)) {
+			cout << "Crowded old array lost an element\n";
+			return 1;
+		}
+	}
+
+	//zero-copy lookups by string_view and const char*
+	HashTable<string, string> names;
+	const string prefix = "a key that is much longer than the small string buffer ";
+	for (int i = 0; i < 1000; i++) names.add(prefix + to_string(i), "value " + to_string(i));
+	string buffer = prefix + "999";
+	string_view view(buffer);
+	size_t before = allocations;
+	const string* found = nullptr;
+	for (int i = 0; i < 10000; i++) {
+		found = names.find_value(view);
+		if (names.find_value(string_view("missing key that is long enough to allocate")) != nullptr) {
+			cout << "Found a missing key\n";
+			return 1;
+		}
+	}
+	if (allocations != before) {
+		cout << "Lookups allocated memory\n";
+		return 1;
+	}
+	if (found == nullptr || *found != "value 999") {
+		cout << "string_view lookup error\n";
+		return 1;
+	}
+	names.add("short", "value");
+	*names.find_value("short") = "";
+	const HashTable<string, string>& constant_names = names;
+	const string* short_value = constant_names.find_value("short");
+	if (names.get_size() != 1001 || short_value == nullptr || !short_value->empty()) {
+		cout << "Write through pointer error\n";
+		return 1;
+	}
+
+	//emplace builds the key only on insertion and doesn't overwrite
+	auto first = names.emplace(string_view("emplaced"), 3, 'x');
+	auto second = names.emplace("emplaced", "other");
+	if (!first.second || second.second || first.first != second.first || *second.first != "xxx") {
+		cout << "Emplace error\n";
+		return 1;
+	}
+
+	//move-insert and overwrite
+	string key = prefix + "moved";
+	string value(100, 'v');
+	names.add(std::move(key), std::move(value));
+	names.add(prefix + "0", "new value");
+	if (*names.find_value(prefix + "moved") != string(100, 'v') || names.find(prefix + "0").second != "new value") {
+		cout << "Move insert error\n";
+		return 1;
+	}
+
+	//batched lookup matches single lookups, including keys in the old array during incremental resize
+	HashTable<uint64_t, uint64_t> batched;
+	batched.set_incremental_resize(true);
+	uint64_t batched_added = 0;
+	vector<uint64_t> batch;
+	for (uint64_t i = 0; i < 1000; i++) {
+		batch.push_back(i * 7);
+		batch.push_back(1000000 + i);
+	}
+	for (int pass = 0; pass < 2; pass++) {
+		while (pass == 0 ? batched_added < 5000 : !batched.is_resizing()) {
+			batched.add(batched_added, batched_added);
+			batched_added++;
+		}
+		vector<const uint64_t*> results(batch.size());
+		size_t found_count = batched.find_many(batch.data(), batch.size(), results.data());
+		size_t expected = 0;
+		for (size_t i = 0; i < batch.size(); i++) {
+			if (results[i] != batched.find_value(batch[i])) {
+				cout << "Batched lookup error\n";
+				return 1;
+			}
+			expected += results[i] != nullptr;
+		}
+		if (found_count != expected || expected == 0 || expected > batch.size() / 2) {
+			cout << "Batched lookup count error\n";
+			return 1;
+		}
+	}
+	string_view names_batch[] = { "emplaced", "missing", "short" };
+	const string* names_results[3];
+	if (names.find_many(names_batch, 3, names_results) != 2 || names_results[1] != nullptr
+		|| *names_results[0] != "xxx" || names_results[2] != names.find_value("short")) {
+		cout << "Batched string lookup error\n";
+		return 1;
+	}
+
 	return 0;
 }
\ No newline at end of file
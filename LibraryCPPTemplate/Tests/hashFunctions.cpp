@@ -0,0 +1,120 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include <cstdlib>
+#include "hashFunctions.h"
+
+//   
+int bitDifference(uint64_t a, uint64_t b) {
+    int count = 0;
+    for (uint64_t x = a ^ b; x; x &= x - 1) {
+        count++;
+    }
+    return count;
+}
+
+//       buckets     
+size_t maxBucket(const std::vector<uint64_t>& hashes, size_t buckets, bool high) {
+    std::vector<size_t> counts(buckets, 0);
+    size_t result = 0;
+    for (size_t i = 0; i < hashes.size(); i++) {
+        size_t bucket = high ? (size_t)(hashes[i] >> 54) % buckets : (size_t)(hashes[i] & (buckets - 1));
+        counts[bucket]++;
+        if (counts[bucket] > result) {
+            result = counts[bucket];
+        }
+    }
+    return result;
+}
+
+int main() {
+    srand(1);
+    std::vector<unsigned char> buffer(256);
+    for (size_t i = 0; i < buffer.size(); i++) {
+        buffer[i] = (unsigned char)rand();
+    }
+
+    //     ,      
+    for (size_t length = 0; length <= 200; length++) {
+        std::vector<unsigned char> copy(buffer.begin() + 1, buffer.begin() + 1 + length);
+        if (hashBytes(buffer.data() + 1, length) != hashBytes(copy.data(), length)) {
+            std::cout << "Hash depends on the address, length " << length << "\n";
+            return 1;
+        }
+    }
+
+    //    ,         
+    std::set<uint64_t> prefixes;
+    std::vector<unsigned char> zeros(256, 0);
+    for (size_t length = 0; length <= 256; length++) {
+        prefixes.insert(hashBytes(buffer.data(), length));
+        prefixes.insert(hashBytes(zeros.data(), length));
+    }
+    if (prefixes.size() != 2 * 257 - 1) {
+        std::cout << "Prefix collisions\n";
+        return 1;
+    }
+
+    //  :          
+    size_t lengths[] = { 1, 3, 4, 8, 13, 16, 17, 40, 48, 49, 100, 200 };
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        size_t length = lengths[l];
+        uint64_t base = hashBytes(buffer.data(), length);
+        long total = 0;
+        for (size_t bit = 0; bit < length * 8; bit++) {
+            std::vector<unsigned char> changed(buffer.begin(), buffer.begin() + length);
+            changed[bit / 8] ^= (unsigned char)(1 << (bit % 8));
+            int difference = bitDifference(base, hashBytes(changed.data(), length));
+            if (difference == 0) {
+                std::cout << "Bit " << bit << " doesn't affect the hash, length " << length << "\n";
+                return 1;
+            }
+            total += difference;
+        }
+        double average = (double)total / (length * 8);
+        if (average < 24 || average > 40) {
+            std::cout << "Weak avalanche for length " << length << ": " << average << "\n";
+            return 1;
+        }
+    }
+
+    //        
+    //     (  ),    ( )
+    const size_t KEYS = 100000;
+    const size_t BUCKETS = 1024;
+    std::vector<uint64_t> strings;
+    std::vector<uint64_t> integers;
+    DefaultHash<std::string> stringHash;
+    DefaultHash<uint64_t> integerHash;
+    for (size_t i = 0; i < KEYS; i++) {
+        strings.push_back(stringHash("key" + std::to_string(i)));
+        integers.push_back(integerHash(i * 1024));
+    }
+    //      98 ;     
+    if (maxBucket(strings, BUCKETS, false) > 160 || maxBucket(strings, BUCKETS, true) > 160
+        || maxBucket(integers, BUCKETS, false) > 160 || maxBucket(integers, BUCKETS, true) > 160) {
+        std::cout << "Uneven distribution\n";
+        return 1;
+    }
+
+    // 128- :      ,  -   
+    for (int i = 0; i < 1000; i++) {
+        uint64_t a = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+        uint64_t b = ((uint64_t)rand() << 35) ^ ((uint64_t)rand() << 7) ^ (uint64_t)rand();
+        uint64_t low = a, high = b;
+        hashMultiply(low, high);
+        if (low != a * b) {
+            std::cout << "Invalid 128-bit product\n";
+            return 1;
+        }
+        uint64_t aHigh = a >> 32, bHigh = b >> 32;
+        if (high < aHigh * bHigh || high > aHigh * bHigh + (aHigh + bHigh) * 2 + 2) {
+            std::cout << "Invalid high part of the product\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,89 @@
+#ifndef HASHTABLETESTS_H
+#define HASHTABLETESTS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+
+//     -   add, del, find  get_size.
+// find    (  , ),    Value.
+
+//  -:     HASH
+template <size_t HASH>
+struct ConstantHash {
+    template <typename Key>
+    size_t operator()(const Key&) const { return HASH; }
+};
+
+inline uint64_t integerKey(size_t i) {
+    return i * 0x100000001ull;
+}
+
+inline std::string stringKey(size_t i) {
+    return "key" + std::to_string(i);
+}
+
+inline size_t indexValue(size_t i) {
+    return i;
+}
+
+//    0  39,   i
+inline std::string stringValue(size_t i) {
+    return std::string(i % 40, (char)('a' + i % 26));
+}
+
+//      std::unordered_map   makeKey(0 ... range - 1);
+//     i - makeValue(i)
+template <typename Table, typename Key, typename Value>
+bool randomCompare(Table& table, size_t operations, size_t range, Key (*makeKey)(size_t), Value (*makeValue)(size_t)) {
+    std::unordered_map<Key, Value> reference;
+    for (size_t i = 0; i < operations; i++) {
+        Key key = makeKey((size_t)rand() % range);
+        int operation = rand() % 3;
+        if (operation == 0) {
+            Value value = makeValue(i);
+            table.add(key, value);
+            reference[key] = value;
+        }
+        else if (operation == 1) {
+            table.del(key);
+            reference.erase(key);
+        }
+        else {
+            auto result = table.find(key);
+            auto it = reference.find(key);
+            if (result.first != (it != reference.end()) || (result.first && result.second != it->second)) {
+                return false;
+            }
+        }
+        if (table.get_size() != reference.size()) {
+            return false;
+        }
+    }
+    for (auto it = reference.begin(); it != reference.end(); ++it) {
+        auto result = table.find(it->first);
+        if (!result.first || result.second != it->second) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//      (  ConstantHash):  count   
+//       
+template <typename Table, typename Key, typename Value>
+bool collisionCompare(Table& table, size_t count, Key (*makeKey)(size_t), Value (*makeValue)(size_t)) {
+    for (size_t i = 0; i < count; i++) table.add(makeKey(i), makeValue(i));
+    for (size_t i = 0; i < count; i += 3) table.del(makeKey(i));
+    for (size_t i = 0; i < count; i++) {
+        auto result = table.find(makeKey(i));
+        if (result.first != (i % 3 != 0) || (result.first && result.second != makeValue(i))) {
+            return false;
+        }
+    }
+    return table.get_size() == count - (count + 2) / 3;
+}
+
+#endif // HASHTABLETESTS_H
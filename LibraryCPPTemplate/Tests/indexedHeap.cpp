@@ -0,0 +1,116 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "indexedHeap.h"
+
+const size_t ID_COUNT = 1000;
+const int NO_KEY = -1;
+
+//        (   -   )
+int bruteMinKey(const std::vector<int>& keys) {
+    int result = NO_KEY;
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] != NO_KEY && (result == NO_KEY || keys[i] < result)) {
+            result = keys[i];
+        }
+    }
+    return result;
+}
+
+int main() {
+    IndexedHeap<int> heap(ID_COUNT);
+    std::vector<int> keys(ID_COUNT, NO_KEY);
+
+    //       
+    srand(1);
+    for (int step = 0; step < 100000; step++) {
+        size_t id = rand() % ID_COUNT;
+        int key = rand() % 100000;
+        switch (rand() % 5) {
+        case 0:
+            if (!heap.contains(id)) {
+                heap.insert(id, key);
+                keys[id] = key;
+            }
+            break;
+        case 1:
+            if (heap.contains(id) && key <= keys[id]) {
+                heap.decreaseKey(id, key);
+                keys[id] = key;
+            }
+            break;
+        case 2:
+            if (heap.contains(id) && key >= keys[id]) {
+                heap.increaseKey(id, key);
+                keys[id] = key;
+            }
+            break;
+        case 3:
+            if (heap.contains(id)) {
+                heap.erase(id);
+                keys[id] = NO_KEY;
+            }
+            break;
+        default:
+            heap.update(id, key);
+            keys[id] = key;
+            break;
+        }
+        if (heap.contains(id) != (keys[id] != NO_KEY)) {
+            std::cout << "Invalid contains\n";
+            return 1;
+        }
+        if (!heap.empty() && heap.getMinKey() != bruteMinKey(keys)) {
+            std::cout << "Invalid minimum\n";
+            return 1;
+        }
+    }
+
+    //        
+    int previous = NO_KEY;
+    while (!heap.empty()) {
+        int key = heap.getMinKey();
+        size_t id = heap.extractMin();
+        if (key != keys[id] || key < previous || heap.contains(id)) {
+            std::cout << "Invalid extraction order\n";
+            return 1;
+        }
+        keys[id] = NO_KEY;
+        previous = key;
+    }
+    if (bruteMinKey(keys) != NO_KEY) {
+        std::cout << "Some ids were lost\n";
+        return 1;
+    }
+
+    //   
+    heap.insert(5, 10);
+    try {
+        heap.insert(5, 20);
+        std::cout << "Duplicate insert must throw\n";
+        return 1;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    try {
+        heap.decreaseKey(5, 30);
+        std::cout << "Increasing key with decreaseKey must throw\n";
+        return 1;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    try {
+        heap.erase(6);
+        std::cout << "Erasing absent id must throw\n";
+        return 1;
+    }
+    catch (const std::out_of_range&) {
+    }
+    heap.clear();
+    if (!heap.empty() || heap.contains(5)) {
+        std::cout << "Invalid clear\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include <cstdio>
+#include "mappedHashTable.h"
+
+const char* FILE_NAME = "TestMappedHashTable.bin";
+
+//     
+bool openFails(const std::string& path) {
+    try {
+        MappedHashTable table(path);
+    }
+    catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+int main() {
+    // : ,     
+    const size_t SIZE = 100000;
+    MappedHashTableBuilder builder;
+    for (size_t i = 0; i < SIZE; i++) {
+        builder.add("key" + std::to_string(i), "value" + std::to_string(i));
+    }
+    for (size_t i = 0; i < SIZE; i += 10) {
+        builder.add("key" + std::to_string(i), "new" + std::to_string(i));
+    }
+    builder.add("", "empty");
+    builder.save(FILE_NAME);
+
+    {
+        MappedHashTable table(FILE_NAME);
+        if (table.get_size() != SIZE + 1 || table.get_capacity() * 3 < table.get_size() * 4) {
+            std::cout << "Invalid size\n";
+            return 1;
+        }
+        for (size_t i = 0; i < SIZE; i++) {
+            std::pair<bool, std::string_view> result = table.find("key" + std::to_string(i));
+            std::string expected = (i % 10 == 0 ? "new" : "value") + std::to_string(i);
+            if (!result.first || result.second != expected) {
+                std::cout << "Search error for key" << i << "\n";
+                return 1;
+            }
+        }
+        for (size_t i = SIZE; i < SIZE + 1000; i++) {
+            if (table.find("key" + std::to_string(i)).first) {
+                std::cout << "Found absent key\n";
+                return 1;
+            }
+        }
+        if (table.find("").second != "empty") {
+            std::cout << "Empty key error\n";
+            return 1;
+        }
+    }
+
+    //  
+    MappedHashTableBuilder().save(FILE_NAME);
+    {
+        MappedHashTable table(FILE_NAME);
+        if (table.get_size() != 0 || table.find("key").first) {
+            std::cout << "Empty table error\n";
+            return 1;
+        }
+    }
+
+    //    
+    if (!openFails("TestMappedHashTableMissing.bin")) {
+        std::cout << "Missing file was opened\n";
+        return 1;
+    }
+    {
+        std::ofstream file(FILE_NAME, std::ios::binary | std::ios::trunc);
+        file << "not a hash table file, just some text that is longer than the header";
+    }
+    if (!openFails(FILE_NAME)) {
+        std::cout << "File with invalid signature was opened\n";
+        return 1;
+    }
+    builder.save(FILE_NAME);
+    {
+        std::ifstream file(FILE_NAME, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+        std::ofstream truncated(FILE_NAME, std::ios::binary | std::ios::trunc);
+        truncated.write(content.data(), (std::streamsize)(content.size() / 2));
+    }
+    if (!openFails(FILE_NAME)) {
+        std::cout << "Truncated file was opened\n";
+        return 1;
+    }
+
+    std::remove(FILE_NAME);
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <set>
+#include <iterator>
+#include <string>
+#include <cstdlib>
+#include "minMaxHeap.h"
+
+int main() {
+    MinMaxHeap<int> heap;
+    std::multiset<int> expected;
+
+    //           
+    srand(1);
+    for (int step = 0; step < 200000; step++) {
+        int operation = rand() % 4;
+        if (operation < 2 || expected.empty()) {
+            int value = rand() % 1000;
+            heap.insert(value);
+            expected.insert(value);
+        }
+        else if (operation == 2) {
+            if (heap.extractMin() != *expected.begin()) {
+                std::cout << "Invalid extractMin\n";
+                return 1;
+            }
+            expected.erase(expected.begin());
+        }
+        else {
+            if (heap.extractMax() != *expected.rbegin()) {
+                std::cout << "Invalid extractMax\n";
+                return 1;
+            }
+            expected.erase(std::prev(expected.end()));
+        }
+        if (heap.size() != expected.size()) {
+            std::cout << "Invalid size\n";
+            return 1;
+        }
+        if (!heap.empty() && (heap.getMin() != *expected.begin() || heap.getMax() != *expected.rbegin())) {
+            std::cout << "Invalid min or max\n";
+            return 1;
+        }
+    }
+
+    //       
+    while (!heap.empty()) {
+        if (heap.extractMax() != *expected.rbegin()) {
+            std::cout << "Invalid drain order\n";
+            return 1;
+        }
+        expected.erase(std::prev(expected.end()));
+        if (!heap.empty()) {
+            if (heap.extractMin() != *expected.begin()) {
+                std::cout << "Invalid drain order\n";
+                return 1;
+            }
+            expected.erase(expected.begin());
+        }
+    }
+
+    try {
+        heap.getMax();
+        std::cout << "Access to empty heap must throw\n";
+        return 1;
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    //       
+    MinMaxHeap<std::string, std::greater<std::string>> strings;
+    strings.insert("b");
+    strings.insert("a");
+    strings.insert("c");
+    if (strings.getMin() != "c" || strings.getMax() != "a") {
+        std::cout << "Invalid custom comparator\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include "multiQueue.h"
+
+const int OPERATIONS = 200000;
+
+//  :       
+template <typename Queue>
+double runMixed(Queue& queue, size_t threads) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.push_back(std::thread([&queue, threads, t]() {
+            int operations = OPERATIONS / (int)threads;
+            int value = 0;
+            for (int i = 0; i < operations; i++) {
+                queue.insert((int)t * OPERATIONS + i);
+                if (i % 2) {
+                    queue.tryExtractMin(value);
+                }
+            }
+        }));
+    }
+    for (size_t t = 0; t < workers.size(); t++) {
+        workers[t].join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//  :     
+struct LockedHeap {
+    std::mutex mutex;
+    BinaryHeap<int> heap;
+
+    void insert(int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        heap.insert(value);
+    }
+
+    bool tryExtractMin(int& result) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (heap.empty()) {
+            return false;
+        }
+        result = heap.extractMin();
+        return true;
+    }
+};
+
+int main() {
+    //          
+    const size_t threads = 8;
+    const int perThread = 10000;
+    MultiQueue<int> queue(threads);
+    std::vector<std::thread> producers;
+    for (size_t t = 0; t < threads; t++) {
+        producers.push_back(std::thread([&queue, t]() {
+            for (int i = 0; i < perThread; i++) {
+                queue.insert((int)t * perThread + i);
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads; t++) {
+        producers[t].join();
+    }
+    if (queue.size() != threads * perThread) {
+        std::cout << "Invalid size after parallel inserts\n";
+        return 1;
+    }
+    std::vector<std::vector<int>> popped(threads);
+    std::vector<std::thread> consumers;
+    for (size_t t = 0; t < threads; t++) {
+        consumers.push_back(std::thread([&queue, &popped, t]() {
+            int value = 0;
+            while (queue.tryExtractMin(value)) {
+                popped[t].push_back(value);
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads; t++) {
+        consumers[t].join();
+    }
+    std::vector<int> seen(threads * perThread, 0);
+    for (size_t t = 0; t < threads; t++) {
+        for (size_t i = 0; i < popped[t].size(); i++) {
+            seen[popped[t][i]]++;
+        }
+    }
+    for (size_t i = 0; i < seen.size(); i++) {
+        if (seen[i] != 1) {
+            std::cout << "Element " << i << " extracted " << seen[i] << " times\n";
+            return 1;
+        }
+    }
+
+    //  :         
+    MultiQueue<int> relaxed(4, 2, 2);
+    const int count = 20000;
+    for (int i = 0; i < count; i++) {
+        relaxed.insert(count - 1 - i);
+    }
+    std::vector<bool> removed(count, false);
+    size_t rankErrorSum = 0;
+    int smallest = 0;
+    int value = 0;
+    while (relaxed.tryExtractMin(value)) {
+        rankErrorSum += value - smallest;
+        removed[value] = true;
+        while (smallest < count && removed[smallest]) {
+            smallest++;
+        }
+    }
+    double rankError = (double)rankErrorSum / count;
+    std::cout << "Average rank error with " << relaxed.getQueueCount() << " queues: " << rankError << "\n";
+    if (rankError > 10.0 * relaxed.getQueueCount()) {
+        std::cout << "Rank error is too large\n";
+        return 1;
+    }
+
+    //            
+    for (size_t t = 1; t <= 64; t *= 2) {
+        MultiQueue<int> multi(t);
+        LockedHeap locked;
+        double multiTime = runMixed(multi, t);
+        double lockedTime = runMixed(locked, t);
+        std::cout << "threads " << t << ": MultiQueue " << (int)(OPERATIONS / multiTime)
+                  << " ops/s, locked heap " << (int)(OPERATIONS / lockedTime) << " ops/s\n";
+    }
+
+    return 0;
+}
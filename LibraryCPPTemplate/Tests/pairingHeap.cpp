@@ -0,0 +1,114 @@
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "pairingHeap.h"
+
+typedef PairingHeap<long long> MyHeap;
+
+//  :   -  ,     
+const long long SERIAL = 1000000;
+
+int main() {
+    MyHeap heap;
+    std::multiset<long long> expected;
+    long long serial = 0;
+    std::vector<MyHeap::Handle> handles;
+
+    //  , ,        
+    srand(1);
+    for (int step = 0; step < 100000; step++) {
+        int operation = rand() % 5;
+        if (operation < 2 || expected.empty()) {
+            long long value = (rand() % 100000) * SERIAL + serial++;
+            handles.push_back(heap.insert(value));
+            expected.insert(value);
+        }
+        else if (operation == 2) {
+            long long value = heap.extractMin();
+            if (value != *expected.begin()) {
+                std::cout << "Invalid extractMin\n";
+                return 1;
+            }
+            expected.erase(expected.begin());
+            //      
+            for (size_t i = 0; i < handles.size(); i++) {
+                if (MyHeap::getValue(handles[i]) == value) {
+                    handles[i] = handles.back();
+                    handles.pop_back();
+                    break;
+                }
+            }
+        }
+        else if (operation == 3) {
+            size_t index = rand() % handles.size();
+            long long old = MyHeap::getValue(handles[index]);
+            long long value = old - (rand() % 1000) * SERIAL;
+            heap.decreaseKey(handles[index], value);
+            expected.erase(expected.find(old));
+            expected.insert(value);
+        }
+        else {
+            size_t index = rand() % handles.size();
+            expected.erase(expected.find(MyHeap::getValue(handles[index])));
+            heap.erase(handles[index]);
+            handles[index] = handles.back();
+            handles.pop_back();
+        }
+        if (heap.size() != expected.size() || (!heap.empty() && heap.getMin() != *expected.begin())) {
+            std::cout << "Invalid heap state\n";
+            return 1;
+        }
+    }
+
+    // :        
+    MyHeap other;
+    std::vector<MyHeap::Handle> otherHandles;
+    for (int i = 0; i < 10000; i++) {
+        otherHandles.push_back(other.insert(200000 * SERIAL + i));
+        expected.insert(200000 * SERIAL + i);
+    }
+    heap.merge(other);
+    if (!other.empty() || heap.size() != expected.size()) {
+        std::cout << "Invalid merge sizes\n";
+        return 1;
+    }
+    heap.decreaseKey(otherHandles[5000], -1);
+    expected.erase(expected.find(200000 * SERIAL + 5000));
+    expected.insert(-1);
+    //         
+    other.insert(1);
+    other.insert(0);
+    if (other.extractMin() != 0) {
+        std::cout << "Invalid heap after merge\n";
+        return 1;
+    }
+    while (!heap.empty()) {
+        if (heap.extractMin() != *expected.begin()) {
+            std::cout << "Invalid order after merge\n";
+            return 1;
+        }
+        expected.erase(expected.begin());
+    }
+
+    try {
+        heap.extractMin();
+        std::cout << "Extraction from empty heap must throw\n";
+        return 1;
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    //        
+    PairingHeap<std::string> strings;
+    PairingHeap<std::string>::Handle handle = strings.insert("zzz");
+    strings.insert("bbb");
+    strings.decreaseKey(handle, "aaa");
+    if (strings.getMin() != "aaa") {
+        std::cout << "Invalid string heap\n";
+        return 1;
+    }
+
+    return 0;
+}
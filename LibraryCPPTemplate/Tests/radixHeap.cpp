@@ -0,0 +1,131 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "radixHeap.h"
+#include "binaryHeap.h"
+
+const size_t VERTEX_COUNT = 2000;
+const size_t EDGE_COUNT = 10000;
+const unsigned int MAX_WEIGHT = 100;
+const unsigned int INF = static_cast<unsigned int>(-1);
+
+struct Edge {
+    size_t to;
+    unsigned int weight;
+};
+
+typedef std::vector<std::vector<Edge>> Graph;
+
+//          insert(key, vertex) / extractMin
+template <typename Queue>
+std::vector<unsigned int> dijkstra(const Graph& graph, Queue& queue) {
+    std::vector<unsigned int> distance(graph.size(), INF);
+    distance[0] = 0;
+    queue.insert(0, 0);
+    while (!queue.empty()) {
+        std::pair<unsigned int, size_t> top = queue.extractMin();
+        if (top.first > distance[top.second]) {
+            continue;
+        }
+        for (size_t i = 0; i < graph[top.second].size(); i++) {
+            const Edge& edge = graph[top.second][i];
+            unsigned int candidate = top.first + edge.weight;
+            if (candidate < distance[edge.to]) {
+                distance[edge.to] = candidate;
+                queue.insert(candidate, edge.to);
+            }
+        }
+    }
+    return distance;
+}
+
+//     
+struct HeapQueue {
+    BinaryHeap<std::pair<unsigned int, size_t>> heap;
+
+    void insert(unsigned int key, size_t vertex) { heap.insert(std::make_pair(key, vertex)); }
+    std::pair<unsigned int, size_t> extractMin() { return heap.extractMin(); }
+    bool empty() const { return heap.empty(); }
+};
+
+//   DialQueue     
+struct DialAdapter {
+    DialQueue<size_t> queue;
+
+    DialAdapter() : queue(MAX_WEIGHT) {}
+    void insert(unsigned int key, size_t vertex) { queue.insert(key, vertex); }
+    std::pair<unsigned int, size_t> extractMin() {
+        std::pair<size_t, size_t> top = queue.extractMin();
+        return std::make_pair(static_cast<unsigned int>(top.first), top.second);
+    }
+    bool empty() const { return queue.empty(); }
+};
+
+int main() {
+    srand(1);
+    Graph graph(VERTEX_COUNT);
+    for (size_t i = 0; i < EDGE_COUNT; i++) {
+        Edge edge;
+        edge.to = rand() % VERTEX_COUNT;
+        edge.weight = rand() % (MAX_WEIGHT + 1);
+        graph[rand() % VERTEX_COUNT].push_back(edge);
+    }
+
+    HeapQueue heapQueue;
+    RadixHeap<size_t> radixQueue;
+    DialAdapter dialQueue;
+    std::vector<unsigned int> expected = dijkstra(graph, heapQueue);
+    if (dijkstra(graph, radixQueue) != expected) {
+        std::cout << "Invalid RadixHeap distances\n";
+        return 1;
+    }
+    if (dijkstra(graph, dialQueue) != expected) {
+        std::cout << "Invalid DialQueue distances\n";
+        return 1;
+    }
+
+    //    64-   
+    RadixHeap<int, unsigned long long> wide;
+    std::vector<unsigned long long> keys;
+    unsigned long long base = 0;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 100; i++) {
+            unsigned long long key = base + (static_cast<unsigned long long>(rand()) << (rand() % 32));
+            wide.insert(key, i);
+            keys.push_back(key);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (int i = 0; i < 50; i++) {
+            if (wide.getMinKey() != keys.front() || wide.extractMin().first != keys.front()) {
+                std::cout << "Invalid 64-bit extraction order\n";
+                return 1;
+            }
+            base = keys.front();
+            keys.erase(keys.begin());
+        }
+    }
+    if (wide.size() != keys.size()) {
+        std::cout << "Invalid size\n";
+        return 1;
+    }
+
+    //    
+    try {
+        wide.insert(base - 1, 0);
+        std::cout << "Key below the last extracted one must throw\n";
+        return 1;
+    }
+    catch (const std::invalid_argument&) {
+    }
+    wide.clear();
+    try {
+        wide.extractMin();
+        std::cout << "Extraction from empty heap must throw\n";
+        return 1;
+    }
+    catch (const std::out_of_range&) {
+    }
+
+    return 0;
+}
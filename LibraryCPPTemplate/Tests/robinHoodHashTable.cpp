@@ -0,0 +1,88 @@
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include "robinHoodHashTable.h"
+#include "hashTableTests.h"
+
+// ,      :     d > 1
+//       d - 1.       p 
+// ,     ,   ,   
+template <typename Table>
+bool checkOrder(const Table& table) {
+    size_t capacity = table.get_capacity();
+    for (size_t i = 0; i < capacity; i++) {
+        size_t distance = table.get_distance(i);
+        if (distance > 1 && table.get_distance((i + capacity - 1) % capacity) + 1 < distance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    srand(1);
+
+    RobinHoodHashTable<uint64_t, size_t> integers;
+    if (!randomCompare(integers, 500000, 5000, integerKey, indexValue) || !checkOrder(integers)) {
+        std::cout << "Integer table differs from unordered_map\n";
+        return 1;
+    }
+
+    RobinHoodHashTable<std::string, size_t> words;
+    if (!randomCompare(words, 200000, 20000, stringKey, indexValue) || !checkOrder(words)) {
+        std::cout << "String table differs from unordered_map\n";
+        return 1;
+    }
+
+    //  :    ,      .
+    //         ,   
+    const size_t LIVE = 20000;
+    RobinHoodHashTable<uint64_t, uint64_t> sessions;
+    for (uint64_t i = 0; i < LIVE; i++) sessions.add(i, i);
+    size_t capacity = sessions.get_capacity();
+    for (uint64_t i = LIVE; i < LIVE * 50; i++) {
+        sessions.del(i - LIVE);
+        sessions.add(i, i);
+        if (sessions.get_capacity() != capacity) {
+            std::cout << "Table was rebuilt under churn\n";
+            return 1;
+        }
+        if (i % 100000 == 0 && !checkOrder(sessions)) {
+            std::cout << "Robin Hood order broken under churn\n";
+            return 1;
+        }
+    }
+    for (uint64_t i = 0; i < LIVE * 50; i++) {
+        std::pair<bool, uint64_t> result = sessions.find(i);
+        if (result.first != (i >= LIVE * 49) || (result.first && result.second != i)) {
+            std::cout << "Session search error\n";
+            return 1;
+        }
+    }
+    //     80%    
+    if (sessions.get_max_distance() > 64) {
+        std::cout << "Probe sequences are too long: " << sessions.get_max_distance() << "\n";
+        return 1;
+    }
+
+    //     :      ,
+    //          
+    RobinHoodHashTable<uint64_t, size_t, ConstantHash<7>> collisions;
+    if (!collisionCompare(collisions, 300, integerKey, indexValue) || !checkOrder(collisions)) {
+        std::cout << "Collision handling error\n";
+        return 1;
+    }
+    if (collisions.get_max_distance() != 200) {
+        std::cout << "Backward shift left gaps\n";
+        return 1;
+    }
+    for (size_t i = 0; i < 200; i++) {
+        if (collisions.get_distance((7 + i) % collisions.get_capacity()) != i + 1) {
+            std::cout << "Collision chain is not contiguous\n";
+            return 1;
+        }
+    }
+
+    return 0;
+}
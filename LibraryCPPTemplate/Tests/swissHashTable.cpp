@@ -0,0 +1,115 @@
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include "swissHashTable.h"
+#include "hashTableTests.h"
+
+int main() {
+    srand(1);
+
+    //  : , ,  
+    const size_t SIZE = 300000;
+    SwissHashTable<uint64_t, uint64_t> ids;
+    for (uint64_t i = 0; i < SIZE; i++) ids.add(i, i * 2);
+    for (uint64_t i = 0; i < SIZE; i += 2) ids.del(i);
+    if (ids.get_size() != SIZE / 2) {
+        std::cout << "Invalid size\n";
+        return 1;
+    }
+    for (uint64_t i = 0; i < SIZE + 1000; i++) {
+        std::pair<bool, uint64_t> result = ids.find(i);
+        if (result.first != (i < SIZE && i % 2 == 1) || (result.first && result.second != i * 2)) {
+            std::cout << "Search error\n";
+            return 1;
+        }
+    }
+
+    //       :  
+    //     
+    SwissHashTable<uint64_t, size_t> churn;
+    if (!randomCompare(churn, 500000, 1000, integerKey, indexValue)) {
+        std::cout << "Integer table differs from unordered_map\n";
+        return 1;
+    }
+
+    SwissHashTable<std::string, size_t> words;
+    if (!randomCompare(words, 200000, 20000, stringKey, indexValue)) {
+        std::cout << "String table differs from unordered_map\n";
+        return 1;
+    }
+
+    //        (EMPTY,   DELETED):
+    //             
+    SwissHashTable<uint64_t, uint64_t> sparse;
+    const uint64_t LIVE = 8;
+    for (uint64_t i = 0; i < LIVE; i++) sparse.add(i, i);
+    for (uint64_t i = LIVE; i < 100000; i++) {
+        sparse.add(i, i);
+        sparse.del(i - LIVE);
+        if (sparse.get_deleted() != 0 || sparse.get_capacity() != 16) {
+            std::cout << "Deletion in a sparse group left a tombstone\n";
+            return 1;
+        }
+    }
+
+    //     (56  64),       
+    //  DELETED.      ,   grow
+    //      :   ,  
+    SwissHashTable<uint64_t, uint64_t> tombstones;
+    const uint64_t FULL = 56;
+    for (uint64_t i = 0; i < FULL; i++) tombstones.add(i, i);
+    size_t capacity = tombstones.get_capacity();
+    for (uint64_t i = 0; i < FULL - 10; i++) tombstones.del(i);
+    if (capacity != 64 || tombstones.get_deleted() < 16) {
+        std::cout << "Deletion in dense groups didn't leave tombstones\n";
+        return 1;
+    }
+    bool rebuilt = false;
+    uint64_t next = 1000;
+    while (!rebuilt && next < 1100) {
+        size_t deleted = tombstones.get_deleted();
+        tombstones.add(next, next);
+        next++;
+        rebuilt = deleted > 1 && tombstones.get_deleted() == 0;
+    }
+    if (!rebuilt || tombstones.get_capacity() != capacity) {
+        std::cout << "Tombstones were not cleared by a rebuild at the same capacity\n";
+        return 1;
+    }
+    for (uint64_t i = 0; i < next; i++) {
+        std::pair<bool, uint64_t> result = tombstones.find(i);
+        bool present = (i >= FULL - 10 && i < FULL) || i >= 1000;
+        if (result.first != present || (result.first && result.second != i)) {
+            std::cout << "Search error after rebuild\n";
+            return 1;
+        }
+    }
+
+    //   13  16:   13, 14, 15    0 ... 12  
+    //  ,        
+    SwissHashTable<uint64_t, uint64_t, ConstantHash<(13 << 7) | 5>> wrapped;
+    for (uint64_t i = 0; i < 12; i++) wrapped.add(i, i);
+    for (uint64_t i = 0; i < 12; i += 4) wrapped.del(i);
+    wrapped.add(100, 100);
+    for (uint64_t i = 0; i < 12; i++) {
+        std::pair<bool, uint64_t> result = wrapped.find(i);
+        if (result.first != (i % 4 != 0) || (result.first && result.second != i)) {
+            std::cout << "Wrap-around search error\n";
+            return 1;
+        }
+    }
+    if (wrapped.get_capacity() != 16 || !wrapped.find(100).first || wrapped.find(12).first) {
+        std::cout << "Wrap-around insertion error\n";
+        return 1;
+    }
+
+    //   :      
+    SwissHashTable<uint64_t, size_t, ConstantHash<12345>> collisions;
+    if (!collisionCompare(collisions, 300, integerKey, indexValue)) {
+        std::cout << "Collision handling error\n";
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+#include "timerWheel.h"
+
+//     
+struct Expected {
+    uint64_t expiry;
+    TimerHandle handle;
+    bool cancelled;
+    bool fired;
+};
+
+std::vector<Expected> timers;
+TimerWheel<size_t>* wheel = nullptr;
+bool failed = false;
+
+//           
+void onExpire(size_t id) {
+    if (timers[id].cancelled || timers[id].fired || timers[id].expiry != wheel->getTime()) {
+        failed = true;
+    }
+    timers[id].fired = true;
+}
+
+uint64_t randomDelay() {
+    uint64_t r = (uint64_t)rand() * RAND_MAX + rand();
+    switch (rand() % 4) {
+    case 0:
+        return r % 256;
+    case 1:
+        return r % 100000;
+    case 2:
+        return r % (1ull << 30);
+    default:
+        //     
+        return (1ull << 32) + r % (1ull << 34);
+    }
+}
+
+int main() {
+    TimerWheel<size_t> timerWheel(1000);
+    wheel = &timerWheel;
+    srand(1);
+
+    size_t activeCount = 0;
+    for (int round = 0; round < 200; round++) {
+        for (int i = 0; i < 200; i++) {
+            Expected timer;
+            uint64_t delay = randomDelay();
+            timer.expiry = timerWheel.getTime() + (delay ? delay : 1);
+            timer.cancelled = false;
+            timer.fired = false;
+            timer.handle = timerWheel.armAfter(delay, timers.size());
+            timers.push_back(timer);
+            activeCount++;
+        }
+        //    ,   
+        for (int i = 0; i < 150; i++) {
+            size_t id = rand() % timers.size();
+            bool active = !timers[id].cancelled && !timers[id].fired;
+            if (timerWheel.cancel(timers[id].handle) != active) {
+                std::cout << "Invalid cancel result\n";
+                return 1;
+            }
+            if (active) {
+                timers[id].cancelled = true;
+                activeCount--;
+            }
+        }
+        size_t fired = timerWheel.advance(timerWheel.getTime() + randomDelay() / 16, onExpire);
+        activeCount -= fired;
+        if (failed || timerWheel.size() != activeCount) {
+            std::cout << "Invalid expiration\n";
+            return 1;
+        }
+    }
+
+    //    
+    uint64_t last = 0;
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (!timers[i].cancelled && !timers[i].fired && timers[i].expiry > last) {
+            last = timers[i].expiry;
+        }
+    }
+    timerWheel.advance(last, onExpire);
+    if (failed || !timerWheel.empty()) {
+        std::cout << "Not all timers expired\n";
+        return 1;
+    }
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (!timers[i].cancelled && !timers[i].fired) {
+            std::cout << "Timer " << i << " was lost\n";
+            return 1;
+        }
+        if (timerWheel.isActive(timers[i].handle)) {
+            std::cout << "Handle of expired timer is still active\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdlib>
+#include "topK.h"
+
+const size_t STREAM = 1000000;
+const size_t K = 100;
+
+int main() {
+    srand(1);
+    std::vector<int> stream;
+    for (size_t i = 0; i < STREAM; i++) {
+        stream.push_back(rand());
+    }
+    std::vector<int> sorted = stream;
+    std::sort(sorted.begin(), sorted.end());
+
+    // k    
+    TopK<int> smallest(K);
+    size_t accepted = 0;
+    for (size_t i = 0; i < stream.size(); i++) {
+        if (smallest.offer(stream[i])) {
+            accepted++;
+        }
+    }
+    if (!smallest.full() || smallest.threshold() != sorted[K - 1]) {
+        std::cout << "Invalid threshold\n";
+        return 1;
+    }
+    std::vector<int> result = smallest.drainSorted();
+    if (result != std::vector<int>(sorted.begin(), sorted.begin() + K) || smallest.size() != 0) {
+        std::cout << "Invalid k smallest\n";
+        return 1;
+    }
+    //           ( k ln(n / k))
+    if (accepted > STREAM / 100) {
+        std::cout << "Too many accepted elements: " << accepted << "\n";
+        return 1;
+    }
+
+    // k    
+    TopK<int, std::greater<int>> largest(K);
+    size_t offset = 0;
+    for (size_t batch = 1; offset < stream.size(); batch = batch * 3 + 1) {
+        size_t size = std::min(batch, stream.size() - offset);
+        largest.offerBatch(stream.data() + offset, size);
+        offset += size;
+    }
+    result = largest.drainSorted();
+    if (result != std::vector<int>(sorted.rbegin(), sorted.rbegin() + K)) {
+        std::cout << "Invalid k largest\n";
+        return 1;
+    }
+
+    //   k:   
+    TopK<double> few(10);
+    double values[] = { 3.5, -1.0, 2.0 };
+    few.offerBatch(values, 3);
+    std::vector<double> drained = few.drainSorted();
+    if (drained.size() != 3 || drained[0] != -1.0 || drained[2] != 3.5) {
+        std::cout << "Invalid short stream\n";
+        return 1;
+    }
+
+    return 0;
+}
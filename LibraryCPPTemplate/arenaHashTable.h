@@ -0,0 +1,263 @@
+#ifndef ARENAHASHTABLE_TEMPLATE_H
+#define ARENAHASHTABLE_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "hashFunctions.h"
+
+//   :            .
+//   -     32       , 
+//       .      .
+class StringArena {
+public:
+    static constexpr size_t BLOCK_SIZE = 1 << 20;
+
+    StringArena() : position(0), block_size(0), bytes(0) {}
+
+    //  length ;    
+    uint64_t allocate(size_t length) {
+        if (blocks.empty() || block_size - position < length) {
+            block_size = length > BLOCK_SIZE ? length : BLOCK_SIZE;
+            blocks.emplace_back(new char[block_size]);
+            position = 0;
+        }
+        uint64_t offset = (static_cast<uint64_t>(blocks.size() - 1) << 32) | position;
+        position += length;
+        bytes += length;
+        return offset;
+    }
+
+    char* data(uint64_t offset) {
+        return blocks[offset >> 32].get() + (offset & 0xFFFFFFFFu);
+    }
+
+    const char* data(uint64_t offset) const {
+        return blocks[offset >> 32].get() + (offset & 0xFFFFFFFFu);
+    }
+
+    //    
+    size_t get_bytes() const { return bytes; }
+
+    void swap(StringArena& other) {
+        blocks.swap(other.blocks);
+        std::swap(position, other.position);
+        std::swap(block_size, other.block_size);
+        std::swap(bytes, other.bytes);
+    }
+
+private:
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t position;   //     
+    size_t block_size; //   
+    size_t bytes;      //    
+};
+
+// - ,        ,     std::string.
+//   - 24 :  ,    ,    
+// (      ).    :  
+// ,     .       
+//           std::string.
+//
+//     ;   ,   .
+//      ,    .
+//        ;    ,
+//   ,      .
+//
+// find  std::string_view    ;    
+//  .     HashTable: add, del, find  get_size.
+template <typename Hash = DefaultHash<std::string>>
+class ArenaHashTable {
+public:
+    explicit ArenaHashTable(const Hash& hasher = Hash())
+        : capacity(0), size(0), garbage(0), hasher(hasher) {
+        slots.assign(MIN_CAPACITY, Slot());
+        capacity = MIN_CAPACITY;
+    }
+
+    ArenaHashTable(const ArenaHashTable&) = delete;
+    ArenaHashTable& operator=(const ArenaHashTable&) = delete;
+
+    //  ;    .
+    //       32 ,    - std::length_error
+    void add(std::string_view key, std::string_view value) {
+        if (key.size() > UINT32_MAX || value.size() > UINT32_MAX) {
+            throw std::length_error("Arena hash table key or value is too long");
+        }
+        uint64_t hash = hasher(key);
+        size_t index = find_index(key, hash);
+        if (index != NOT_FOUND) {
+            Slot& slot = slots[index];
+            if (value.size() <= slot.value_length) {
+                //      .     
+                // (, find(key).second.substr(1)),    
+                if (!value.empty()) {
+                    std::memmove(arena.data(slot.offset) + slot.key_length, value.data(), value.size());
+                }
+                garbage += slot.value_length - value.size();
+                slot.value_length = static_cast<uint32_t>(value.size());
+            }
+            else {
+                garbage += slot.key_length + slot.value_length;
+                slot.offset = store(key, value);
+                slot.value_length = static_cast<uint32_t>(value.size());
+            }
+            compact_if_needed();
+            return;
+        }
+        if ((size + 1) * 4 > capacity * 3) {
+            rehash(capacity * 2);
+        }
+        Slot slot;
+        slot.hash = hash;
+        slot.offset = store(key, value);
+        slot.key_length = static_cast<uint32_t>(key.size());
+        slot.value_length = static_cast<uint32_t>(value.size());
+        insert_new(slot);
+        size++;
+    }
+
+    //  
+    void del(std::string_view key) {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return;
+        garbage += slots[index].key_length + slots[index].value_length;
+        size_t mask = capacity - 1;
+        //  :      ,  
+        //       (     )
+        size_t hole = index;
+        for (size_t next = (hole + 1) & mask; slots[next].offset != EMPTY; next = (next + 1) & mask) {
+            size_t home = slots[next].hash & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                slots[hole] = slots[next];
+                hole = next;
+            }
+        }
+        slots[hole] = Slot();
+        size--;
+        compact_if_needed();
+    }
+
+    //  ;      
+    std::pair<bool, std::string_view> find(std::string_view key) const {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return std::make_pair(false, std::string_view());
+        const Slot& slot = slots[index];
+        return std::make_pair(true, std::string_view(arena.data(slot.offset) + slot.key_length, slot.value_length));
+    }
+
+    //    
+    size_t get_size() const { return size; }
+
+    //  
+    size_t get_capacity() const { return capacity; }
+
+    //    ,       
+    size_t get_arena_size() const { return arena.get_bytes(); }
+
+private:
+    static const size_t MIN_CAPACITY = 16;
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+    static const uint64_t EMPTY = static_cast<uint64_t>(-1);
+
+    struct Slot {
+        uint64_t hash;         //  
+        uint64_t offset;       //   (,  )  ; EMPTY -  
+        uint32_t key_length;   //  
+        uint32_t value_length; //  
+
+        Slot() : hash(0), offset(EMPTY), key_length(0), value_length(0) {}
+    };
+
+    std::vector<Slot> slots; //  
+    StringArena arena;       //    
+    size_t capacity;         //  ( )
+    size_t size;             //  
+    size_t garbage;          //       
+    Hash hasher;             // - 
+
+    size_t find_index(std::string_view key, uint64_t hash) const {
+        size_t mask = capacity - 1;
+        for (size_t index = hash & mask; slots[index].offset != EMPTY; index = (index + 1) & mask) {
+            const Slot& slot = slots[index];
+            if (slot.hash == hash && slot.key_length == key.size()
+                && (key.empty() || std::memcmp(arena.data(slot.offset), key.data(), key.size()) == 0)) {
+                return index;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    //    ;    data()    
+    static void copy(char* destination, std::string_view source) {
+        if (!source.empty()) {
+            std::memcpy(destination, source.data(), source.size());
+        }
+    }
+
+    //       
+    uint64_t store(std::string_view key, std::string_view value) {
+        uint64_t offset = arena.allocate(key.size() + value.size());
+        char* data = arena.data(offset);
+        copy(data, key);
+        copy(data + key.size(), value);
+        return offset;
+    }
+
+    //    ,    
+    void insert_new(const Slot& slot) {
+        size_t mask = capacity - 1;
+        size_t index = slot.hash & mask;
+        while (slots[index].offset != EMPTY) {
+            index = (index + 1) & mask;
+        }
+        slots[index] = slot;
+    }
+
+    //      ;    
+    void rehash(size_t new_capacity) {
+        std::vector<Slot> old_slots(new_capacity);
+        old_slots.swap(slots);
+        capacity = new_capacity;
+        for (size_t i = 0; i < old_slots.size(); i++) {
+            if (old_slots[i].offset != EMPTY) {
+                insert_new(old_slots[i]);
+            }
+        }
+    }
+
+    //      ,     .
+    //        
+    void compact_if_needed() {
+        if (garbage < StringArena::BLOCK_SIZE || garbage * 2 < arena.get_bytes()) return;
+        StringArena compacted;
+        for (size_t i = 0; i < capacity; i++) {
+            Slot& slot = slots[i];
+            if (slot.offset != EMPTY) {
+                size_t length = slot.key_length + slot.value_length;
+                uint64_t offset = compacted.allocate(length);
+                std::memcpy(compacted.data(offset), arena.data(slot.offset), length);
+                slot.offset = offset;
+            }
+        }
+        arena.swap(compacted);
+        garbage = 0;
+    }
+};
+
+template <typename Hash>
+const size_t ArenaHashTable<Hash>::MIN_CAPACITY;
+
+template <typename Hash>
+const size_t ArenaHashTable<Hash>::NOT_FOUND;
+
+template <typename Hash>
+const uint64_t ArenaHashTable<Hash>::EMPTY;
+
+#endif // ARENAHASHTABLE_TEMPLATE_H
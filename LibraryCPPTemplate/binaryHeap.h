@@ -0,0 +1,334 @@
+#ifndef BINARYHEAP_TEMPLATE_H
+#define BINARYHEAP_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+//     ;   , Arity      (d- ).
+//        ,  -  ,
+//    . Compare(a, b) == true,  a     b.
+//       ;    
+//      -      std::length_error.
+//
+//   i     Arity * i + 1 ... Arity * i + Arity.   ,
+//        Arity * sizeof(Data) :  4  8 
+//         -      .
+template <typename Data, typename Compare = std::less<Data>, size_t Arity = 2>
+class BinaryHeap {
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+    //   
+    explicit BinaryHeap(const Compare& compare = Compare())
+        : buffer(nullptr), data(nullptr), count(0), capacity(0), memory_limit(0), compare(compare) {}
+
+    //      O(n) :      
+    template <typename InputIt>
+    BinaryHeap(InputIt first, InputIt last, const Compare& compare = Compare())
+        : buffer(nullptr), data(nullptr), count(0), capacity(0), memory_limit(0), compare(compare) {
+        insertMany(first, last);
+    }
+
+    //  
+    BinaryHeap(const BinaryHeap& other)
+        : buffer(nullptr), data(nullptr), count(0), capacity(0), memory_limit(other.memory_limit), compare(other.compare) {
+        reallocate(other.count);
+        for (; count < other.count; count++) {
+            new (data + count) Data(other.data[count]);
+        }
+    }
+
+    //  :    
+    BinaryHeap(BinaryHeap&& other) noexcept
+        : buffer(other.buffer), data(other.data), count(other.count), capacity(other.capacity), memory_limit(other.memory_limit),
+          compare(std::move(other.compare)) {
+        other.buffer = nullptr;
+        other.data = nullptr;
+        other.count = 0;
+        other.capacity = 0;
+    }
+
+    //   (      )
+    BinaryHeap& operator=(BinaryHeap other) {
+        swap(other);
+        return *this;
+    }
+
+    // 
+    ~BinaryHeap() {
+        clear();
+        ::operator delete(buffer);
+    }
+
+    void swap(BinaryHeap& other) noexcept {
+        std::swap(buffer, other.buffer);
+        std::swap(data, other.data);
+        std::swap(count, other.count);
+        std::swap(capacity, other.capacity);
+        std::swap(memory_limit, other.memory_limit);
+        std::swap(compare, other.compare);
+    }
+
+    //   
+    void insert(const Data& value) {
+        emplace(value);
+    }
+
+    //   
+    void insert(Data&& value) {
+        emplace(std::move(value));
+    }
+
+    //            
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        if (count == capacity) {
+            grow();
+        }
+        new (data + count) Data(std::forward<Args>(args)...);
+        count++;
+        siftUp(count - 1);
+    }
+
+    //    .        
+    //  O(n + k),  -      O(k log n)
+    template <typename InputIt>
+    void insertMany(InputIt first, InputIt last) {
+        size_t old_count = count;
+        try {
+            for (; first != last; ++first) {
+                if (count == capacity) {
+                    grow();
+                }
+                new (data + count) Data(*first);
+                count++;
+            }
+        }
+        catch (...) {
+            //         
+            restoreAfter(old_count);
+            throw;
+        }
+        restoreAfter(old_count);
+    }
+
+    //   ( )
+    const Data& getMin() const {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+        return data[0];
+    }
+
+    //   
+    Data extractMin() {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+        Data result = std::move(data[0]);
+        removeRoot();
+        return result;
+    }
+
+    //   k     ;   
+    template <typename OutputIt>
+    size_t extractMany(size_t k, OutputIt out) {
+        size_t extracted = 0;
+        for (; extracted < k && count > 0; extracted++) {
+            *out = std::move(data[0]);
+            ++out;
+            removeRoot();
+        }
+        return extracted;
+    }
+
+    //            
+    void replaceMin(Data value) {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+        data[0] = std::move(value);
+        siftDown(0);
+    }
+
+    //      
+    void removeMin() {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+        removeRoot();
+    }
+
+    size_t size() const { return count; }
+
+    bool empty() const { return count == 0; }
+
+    //  ,    
+    size_t getCapacity() const { return capacity; }
+
+    //     new_capacity 
+    void reserve(size_t new_capacity) {
+        if (new_capacity <= capacity) {
+            return;
+        }
+        if (new_capacity > maxCapacity()) {
+            throw std::length_error("Heap memory limit exceeded");
+        }
+        reallocate(new_capacity);
+    }
+
+    //      
+    void shrink_to_fit() {
+        if (count < capacity) {
+            reallocate(count);
+        }
+    }
+
+    //       , 0 -  .
+    //     ,     .
+    void setMemoryLimit(size_t bytes) {
+        memory_limit = bytes;
+    }
+
+    //   ;      
+    void clear() {
+        for (size_t i = 0; i < count; i++) {
+            data[i].~Data();
+        }
+        count = 0;
+    }
+
+private:
+    //         .
+    //     -    -  ,   .
+    static const size_t CACHE_LINE = 64;
+    static const size_t GROUP_SIZE = Arity * sizeof(Data);
+    static const size_t ALIGNMENT = (GROUP_SIZE <= CACHE_LINE && (GROUP_SIZE & (GROUP_SIZE - 1)) == 0)
+        ? GROUP_SIZE : (GROUP_SIZE > CACHE_LINE ? CACHE_LINE : alignof(Data));
+
+    char* buffer;     //   (   )
+    Data* data;       //     buffer
+    size_t count;     //   
+    size_t capacity;  //     
+    size_t memory_limit; //     (0 -  )
+    Compare compare;  //   
+
+    //  ,   
+    size_t maxCapacity() const {
+        return memory_limit ? memory_limit / sizeof(Data) : static_cast<size_t>(-1) / sizeof(Data);
+    }
+
+    //   :   O(log n)  .
+    //        ,  - .
+    void grow() {
+        size_t limit = maxCapacity();
+        if (capacity >= limit) {
+            throw std::length_error("Heap memory limit exceeded");
+        }
+        size_t new_capacity = capacity ? capacity * 2 : 16;
+        reallocate(new_capacity < limit ? new_capacity : limit);
+    }
+
+    //       .
+    //    Arity - 1  ,    i 
+    //   Arity * (i + 1)        .
+    void reallocate(size_t new_capacity) {
+        char* new_buffer = static_cast<char*>(::operator new((new_capacity + Arity - 1) * sizeof(Data) + ALIGNMENT));
+        uintptr_t address = reinterpret_cast<uintptr_t>(new_buffer);
+        uintptr_t aligned = (address + ALIGNMENT - 1) & ~static_cast<uintptr_t>(ALIGNMENT - 1);
+        Data* new_data = reinterpret_cast<Data*>(aligned) + (Arity - 1);
+        for (size_t i = 0; i < count; i++) {
+            new (new_data + i) Data(std::move_if_noexcept(data[i]));
+            data[i].~Data();
+        }
+        ::operator delete(buffer);
+        buffer = new_buffer;
+        data = new_data;
+        capacity = new_capacity;
+    }
+
+    //         from
+    void restoreAfter(size_t from) {
+        size_t added = count - from;
+        if (added * 4 >= from) {
+            rebuild();
+        }
+        else {
+            for (size_t i = from; i < count; i++) {
+                siftUp(i);
+            }
+        }
+    }
+
+    //     :       ,
+    //    O(n) 
+    void rebuild() {
+        if (count < 2) {
+            return;
+        }
+        for (size_t i = (count - 2) / Arity + 1; i > 0; i--) {
+            siftDown(i - 1);
+        }
+    }
+
+    //         
+    void removeRoot() {
+        count--;
+        if (count > 0) {
+            data[0] = std::move(data[count]);
+        }
+        data[count].~Data();
+        if (count > 1) {
+            siftDown(0);
+        }
+    }
+
+    //  :        "",
+    //        -   
+    void siftUp(size_t index) {
+        Data value = std::move(data[index]);
+        while (index > 0) {
+            size_t parent = (index - 1) / Arity;
+            if (!compare(value, data[parent])) {
+                break;
+            }
+            data[index] = std::move(data[parent]);
+            index = parent;
+        }
+        data[index] = std::move(value);
+    }
+
+    //        "":       
+    void siftDown(size_t index) {
+        Data value = std::move(data[index]);
+        while (true) {
+            size_t first = Arity * index + 1;
+            if (first >= count) {
+                break;
+            }
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t child = first;
+            for (size_t i = first + 1; i < last; i++) {
+                if (compare(data[i], data[child])) {
+                    child = i;
+                }
+            }
+            if (!compare(data[child], value)) {
+                break;
+            }
+            data[index] = std::move(data[child]);
+            index = child;
+        }
+        data[index] = std::move(value);
+    }
+};
+
+// d-     ,  DaryHeap<int, 4>  DaryHeap<Timer, 8, TimerLess>
+template <typename Data, size_t Arity, typename Compare = std::less<Data>>
+using DaryHeap = BinaryHeap<Data, Compare, Arity>;
+
+#endif // BINARYHEAP_TEMPLATE_H
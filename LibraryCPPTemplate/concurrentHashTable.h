@@ -0,0 +1,121 @@
+#ifndef CONCURRENTHASHTABLE_TEMPLATE_H
+#define CONCURRENTHASHTABLE_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "hash.h"
+
+//  -    (shards).
+//        -  HashTable   std::shared_mutex.
+//         ,  
+//     ,  ,   
+// ,    .      .
+//
+//    (seqlock)   :     
+//  (std::string),          .
+//
+// find   ,        
+//   .      HashTable.
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>, typename KeyEqual = std::equal_to<>>
+class ConcurrentHashTable {
+public:
+    // shard_count     ;   -  4 
+    //   ,       
+    explicit ConcurrentHashTable(size_t shard_count = 0, const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : shard_bits(0), hasher(hasher) {
+        if (shard_count == 0) {
+            shard_count = 4 * std::thread::hardware_concurrency();
+        }
+        while (((size_t)1 << shard_bits) < shard_count) {
+            shard_bits++;
+        }
+        size_t count = (size_t)1 << shard_bits;
+        shards.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            shards.push_back(std::unique_ptr<Shard>(new Shard(hasher, equal)));
+        }
+    }
+
+    ConcurrentHashTable(const ConcurrentHashTable&) = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+    //  ;    
+    void add(const Key& key, const Value& value) {
+        size_t hash = hasher(key);
+        Shard& shard = shard_for(hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.table.add(key, hash, value);
+    }
+
+    //  
+    void del(const Key& key) {
+        size_t hash = hasher(key);
+        Shard& shard = shard_for(hash);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.table.del(key, hash);
+    }
+
+    //  ;     ,   -  
+    template <typename K>
+    std::pair<bool, Value> find(const K& key) const {
+        size_t hash = hasher(key);
+        const Shard& shard = shard_for(hash);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const Value* value = shard.table.find_value(key, hash);
+        if (value == nullptr) return std::make_pair(false, Value());
+        return std::make_pair(true, *value);
+    }
+
+    //   (,    )
+    size_t get_size() const {
+        size_t result = 0;
+        for (size_t i = 0; i < shards.size(); i++) {
+            std::shared_lock<std::shared_mutex> lock(shards[i]->mutex);
+            result += shards[i]->table.get_size();
+        }
+        return result;
+    }
+
+    //   :    
+    //       
+    void set_incremental_resize(bool enabled) {
+        for (size_t i = 0; i < shards.size(); i++) {
+            std::unique_lock<std::shared_mutex> lock(shards[i]->mutex);
+            shards[i]->table.set_incremental_resize(enabled);
+        }
+    }
+
+    size_t get_shard_count() const { return shards.size(); }
+
+private:
+    //       -,  
+    //      
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        HashTable<Key, Value, Hash, KeyEqual> table;
+
+        Shard(const Hash& hasher, const KeyEqual& equal) : table(hasher, equal) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t shard_bits;
+    Hash hasher;
+
+    //       :    
+    //           .
+    //       ,     
+    Shard& shard_for(size_t hash) const {
+        if (shard_bits == 0) return *shards[0];
+        uint64_t mixed = (uint64_t)hash * 0x9E3779B97F4A7C15ull;
+        return *shards[(size_t)(mixed >> (64 - shard_bits))];
+    }
+};
+
+#endif // CONCURRENTHASHTABLE_TEMPLATE_H
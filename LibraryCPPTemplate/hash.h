@@ -1,230 +1,446 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <new>
 #include <string>
-#include "array.h"
+#include "hashFunctions.h"
 #include <utility> //   std::pair
-
-//  HashTable   -
+#if defined(_MSC_VER) && !defined(__GNUC__)
+#include <xmmintrin.h> // _mm_prefetch
+#endif
+
+//  HashTable   -      .
+// Key  Value -    , Hash - - , KeyEqual -  .
+//   , std::equal_to<>,      , 
+// find_value  emplace , , std::string_view   .
+//    ,       
+// (, 64- )       ,   ,
+//   .
+//
+//      .       
+//  ,   add.     (set_incremental_resize)
+// ,   Redis,         
+//  add  del    MIGRATE_STEP   .  
+//     ,     ,    .
+//       ,     .
+//           .
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>, typename KeyEqual = std::equal_to<>>
 class HashTable {
 public:
+    //   
+    enum State : unsigned char {
+        EMPTY,    //    -    
+        OCCUPIED, //   
+        DELETED   //   -   ,    
+    };
+
     //      
     struct Element {
-        std::string key;     // 
-        std::string value;   // 
-        bool deleted;        //   
+        Key key;       // 
+        Value value;   // 
+        State state;   //  
         //   
-        Element() : key(""), value(""), deleted(false) {}
+        Element() : key(), value(), state(EMPTY) {}
         //   
-        Element(std::string key, std::string value, bool deleted = false) : key(key), value(value), deleted(deleted) {}
+        Element(const Key& key, const Value& value, State state = OCCUPIED) : key(key), value(value), state(state) {}
+        //  :    key,  -  args  
+        template <typename K, typename... Args>
+        Element(std::piecewise_construct_t, K&& key, Args&&... args)
+            : key(std::forward<K>(key)), value(std::forward<Args>(args)...), state(OCCUPIED) {}
     };
 
 private:
-    Array<Element>* elements; //   -
-    int capacity;             //  
-    int size;                 //   
-    int count_deleted = 0;    //   
-
-    //  - ()
-    static int FirstHashFunction(const std::string& key, int capa) {
-        //   hash,      -.
-        int hash = 0;
-        unsigned long long unique_value = 1;
-
-        //        key.
-        for (size_t i = 0; key[i]; i++) {
-            //      -.
-            //       ,
-            //       - (capa),
-            //  ,       .
-            hash = (hash * unique_value + key[i]) % capa;
-        }
-        return hash % capa;
+    //       
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    //    ,       ,
+    //     ,     
+    static const size_t MIGRATE_STEP = 64;
+
+    //     find_many    
+    static const size_t PREFETCH_BATCH = 16;
+
+    Element* elements;        //   -
+    size_t capacity;          //   (  )
+    size_t size;              //    (  )
+    size_t count_deleted = 0; //   
+    Hash hasher;              // - 
+    KeyEqual equal;           //  
+
+    bool incremental = false;         //   
+    Element* old_elements = nullptr;  //  ,   ;  nullptr
+    size_t old_capacity = 0;          //   
+    size_t migrate_index = 0;         //       
+    Element* next_elements = nullptr; //  ,   
+    size_t next_constructed = 0;      //      
+
+    //       
+    bool check_capacity() {
+        return this->size + 1 + this->count_deleted >= this->capacity / 2;
     }
 
-    //  - (     )
-    static int SecondHashFunction(const std::string& key, int capa) {
-        //  - .
-        int hash = 0;
-
-        //      1.      ,
-        //      ,    FirstHashFunction.
-        unsigned long long unique_value = 1;
-
-        //     .
-        for (size_t i = 0; key[i]; i++) {
-            //  -,   , ASCII  
-            //     .   ,   
-            //    .
-            hash = (hash * unique_value + key[i]) % capa;
-
-            //  27   ,      ,
-            //      -.
-            unique_value *= 27;
-        }
-
-        //   -    ,  ,      .
-        int result = hash % capa;
-
-        //  ,               ,
-        //        ,  ,   .
-        //   ,  1,    .  ,  -    
-        // (        )     .
-        if (result % 2 == 0) return result + 1;
-        return result;
+    //       -.
+    //      ;   -   ,  - .
+    //  -  ,    ,   
+    // ,       .
+    //     migrated (       ) 
+    //   :      .
+    //          ,  
+    //  capa - migrated :        .
+    template <typename K>
+    size_t algorithm(const K& key, Element* in_elements, size_t capa, bool& not_found, size_t migrated = 0) const {
+        return algorithm(key, hasher(key), in_elements, capa, not_found, migrated);
     }
 
-    //   
-    bool check_capacity() {
-        return this->size + this->count_deleted >= this->capacity / 2;
-    }
-
-    ////       -
-    //static int algorithm(const std::string& key, Array<Element>* in_elements, int capa, bool& not_found) {
-    //    //   -     
-    //    int first_hash = FirstHashFunction(key, capa);
-    //    int final_hash = first_hash;
-
-    //    //          ,  
-    //    if (!in_elements->get(final_hash)->key.empty() && !in_elements->get(final_hash)->deleted) {
-    //        //          ,  not_found   
-    //        if (not_found && (key == in_elements->get(final_hash)->key)) {
-    //            not_found = false;
-    //            return final_hash;
-    //        }
-
-    //        //      -   
-    //        int second_hash = SecondHashFunction(key, capa);
-
-    //        //       
-    //        int iter = 1;
-
-    //        //            
-    //        final_hash = (first_hash + iter * second_hash) % capa;
-
-    //        //    ,         
-    //        while (!in_elements->get(final_hash)->key.empty() && !in_elements->get(final_hash)->deleted) {
-    //            //           ,  not_found   
-    //            if (not_found && key == in_elements->get(final_hash)->key) {
-    //                not_found = false;
-    //                return final_hash;
-    //            }
-    //            //      
-    //            iter++;
-    //            final_hash = (first_hash + iter * second_hash) % capa;
-    //        }
-    //    }
-    //    //  ,            
-    //    return final_hash;
-    //}
-
-    //       -
-    static int algorithm(const std::string& key, Array<Element>* in_elements, int capa, bool& not_found) {
-        //       -
-        int first_hash = FirstHashFunction(key, capa);
-        //         -
-        int second_hash = SecondHashFunction(key, capa);
-
-        //    -  
-        int iter = 0;
-        //     ,  -1 (  )
-        int first_deleted_index = -1;
-
-        // ,      
-        while (true) {
-            //  ,   
-            int final_hash = (first_hash + iter * second_hash) % capa;
-            //     
-            Element* elem = in_elements->get(final_hash);
+    //       
+    template <typename K>
+    size_t algorithm(const K& key, size_t hash, Element* in_elements, size_t capa, bool& not_found, size_t migrated = 0) const {
+        size_t mask = capa - 1;
+        //   
+        size_t index = hash & mask;
+        //     
+        size_t step = ((hash >> (sizeof(size_t) * 4)) & mask) | 1;
+
+        //     
+        size_t first_deleted_index = NOT_FOUND;
+
+        // ,          
+        for (size_t probes = 0; probes < capa - migrated; ) {
+            if (index < migrated) {
+                index = (index + step) & mask;
+                continue;
+            }
 
-            //           
-            if (elem->deleted && first_deleted_index == -1) {
-                first_deleted_index = final_hash;
+            //     
+            Element* elem = &in_elements[index];
+            probes++;
+
+            //  :    .      ,
+            //   ,   
+            if (elem->state == EMPTY) {
+                not_found = true;
+                return first_deleted_index != NOT_FOUND ? first_deleted_index : index;
             }
 
-            //         
-            if (elem->key.empty() || elem->key == key) {
-                //         ,   
-                if (elem->key.empty() && first_deleted_index != -1 && not_found) {
-                    return first_deleted_index;
+            //    
+            if (elem->state == DELETED) {
+                if (first_deleted_index == NOT_FOUND) {
+                    first_deleted_index = index;
                 }
-
-                //   not_found    ,   
-                not_found = elem->key.empty();
-                return final_hash;
+            }
+            //     
+            else if (equal(elem->key, key)) {
+                not_found = false;
+                return index;
             }
 
-            //       
-            iter++;
+            //   
+            index = (index + step) & mask;
         }
+
+        //   ,  
+        not_found = true;
+        return first_deleted_index;
     }
 
     //   
     void resize() {
-        //    .
-        int old_capacity = this->capacity;
+        //       .
+        finish_migration();
 
-        //      .
-        this->capacity *= 4;
+        if (incremental) {
+            start_migration();
+            return;
+        }
+
+        //      .
+        Element* old = this->elements;
+        size_t old_capa = this->capacity;
 
-        //       .
-        Array<Element>* new_elements = new Array<Element>(this->capacity);
+        //           .
+        this->capacity *= 4;
+        this->elements = create_elements(this->capacity);
 
         //    .
-        for (int i = 0; i < old_capacity; ++i) {
-            //    .
-            Element* elem = this->elements->get(i);
-            //        ...
-            if (!elem->key.empty() && !elem->deleted) {
-                //   not_found  ,    ,    ,    .
-                bool not_found = true;
-                //             .
-                int index = algorithm(elem->key, new_elements, this->capacity, not_found);
-                //     .
-                new_elements->set(index, *elem);
-            }
+        for (size_t i = 0; i < old_capa; ++i) {
+            move_to_new(old[i]);
         }
 
         //    .
-        delete this->elements;
-        //     .
-        this->elements = new_elements;
+        destroy_elements(old, 0, old_capa);
         //    ,        .
         this->count_deleted = 0;
     }
 
-    //     
-    int find_index(const std::string& key) {
-        //  ,   ,   .
+    //      .    ;
+    //      .       ,
+    //       .
+    void move_to_new(Element& elem) {
+        if (elem.state != OCCUPIED) return;
         bool not_found = true;
+        Element* target = &this->elements[algorithm(elem.key, this->elements, this->capacity, not_found)];
+        if (target->state == DELETED) {
+            this->count_deleted--;
+        }
+        //  :     ,   .
+        *target = std::move(elem);
+    }
+
+    //   count  
+    static Element* create_elements(size_t count) {
+        Element* result = allocate_elements(count);
+        construct_elements(result, 0, count);
+        return result;
+    }
+
+    //   count    
+    static Element* allocate_elements(size_t count) {
+        return static_cast<Element*>(::operator new(count * sizeof(Element)));
+    }
+
+    //    [from, to)
+    static void construct_elements(Element* array, size_t from, size_t to) {
+        for (size_t i = from; i < to; i++) {
+            new (&array[i]) Element();
+        }
+    }
+
+    //   [from, to)    
+    static void destroy_elements(Element* array, size_t from, size_t to) {
+        if (array == nullptr) return;
+        for (size_t i = from; i < to; i++) {
+            array[i].~Element();
+        }
+        ::operator delete(array);
+    }
+
+    //      .  
+    //    -  O(n)  (   ), 
+    //   ,     ,    .
+    //     :      
+    //    capacity / 4 ,    4 * capacity .
+    void prepare(size_t limit) {
+        if (!this->incremental || this->old_elements != nullptr) return;
+        if (this->next_elements == nullptr) {
+            if ((this->size + this->count_deleted) * 4 < this->capacity) return;
+            this->next_elements = allocate_elements(this->capacity * 4);
+            this->next_constructed = 0;
+        }
+        size_t next_capacity = this->capacity * 4;
+        size_t end = next_capacity - this->next_constructed > limit ? this->next_constructed + limit : next_capacity;
+        construct_elements(this->next_elements, this->next_constructed, end);
+        this->next_constructed = end;
+    }
+
+    //   :    ,
+    //         
+    void start_migration() {
+        if (this->next_elements == nullptr) {
+            this->next_elements = allocate_elements(this->capacity * 4);
+            this->next_constructed = 0;
+        }
+        construct_elements(this->next_elements, this->next_constructed, this->capacity * 4);
+        this->old_elements = this->elements;
+        this->old_capacity = this->capacity;
+        this->migrate_index = 0;
+        this->elements = this->next_elements;
+        this->capacity *= 4;
+        this->next_elements = nullptr;
+        this->next_constructed = 0;
+        //           .
+        this->count_deleted = 0;
+    }
+
+    //    limit     .  
+    //  ,        
+    void migrate(size_t limit) {
+        if (this->old_elements == nullptr) return;
+        size_t end = this->old_capacity - this->migrate_index > limit ? this->migrate_index + limit : this->old_capacity;
+        for (; this->migrate_index < end; this->migrate_index++) {
+            Element& elem = this->old_elements[this->migrate_index];
+            move_to_new(elem);
+            elem.~Element();
+        }
+        if (this->migrate_index == this->old_capacity) {
+            ::operator delete(this->old_elements);
+            this->old_elements = nullptr;
+            this->old_capacity = 0;
+            this->migrate_index = 0;
+        }
+    }
 
-        //        .
-        //         ,
-        //       ,   .
-        int hash_index = algorithm(key, this->elements, this->capacity, not_found);
+    void finish_migration() {
+        migrate(this->old_capacity);
+    }
 
-        // ,            .
-        //  ,          .
-        //        ,  -1,     .
-        if (not_found || this->elements->get(hash_index)->deleted) return -1;
+    //     
+    void drop_next() {
+        destroy_elements(this->next_elements, 0, this->next_constructed);
+        this->next_elements = nullptr;
+        this->next_constructed = 0;
+    }
 
-        //         ,   .
+    //        in_elements; NOT_FOUND,   .
+    // migrated -      
+    template <typename K>
+    size_t find_index(const K& key, size_t hash, Element* in_elements, size_t capa, size_t migrated = 0) const {
+        bool not_found = true;
+        size_t hash_index = algorithm(key, hash, in_elements, capa, not_found, migrated);
+        if (not_found) return NOT_FOUND;
         return hash_index;
     }
 
+    //    :    ,   .
+    // nullptr,   ; in_old -      
+    template <typename K>
+    Element* find_element(const K& key, bool& in_old) const {
+        return find_element(key, hasher(key), in_old);
+    }
+
+    //       
+    template <typename K>
+    Element* find_element(const K& key, size_t hash, bool& in_old) const {
+        in_old = false;
+        size_t index = find_index(key, hash, this->elements, this->capacity);
+        if (index != NOT_FOUND) return &this->elements[index];
+        if (this->old_elements != nullptr) {
+            index = find_index(key, hash, this->old_elements, this->old_capacity, this->migrate_index);
+            if (index != NOT_FOUND) {
+                in_old = true;
+                return &this->old_elements[index];
+            }
+        }
+        return nullptr;
+    }
+
+    //      address  ;    
+    static void prefetch(const void* address) {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        (void)address;
+#endif
+    }
+
+    //  :    ,   ,  
+    //    
+    static void prefetch_element(const Element* elem) {
+        prefetch(elem);
+        prefetch(reinterpret_cast<const char*>(elem + 1) - 1);
+    }
+
+    //    find_many        
+    template <typename K>
+    size_t request(const K& key) const {
+        size_t hash = hasher(key);
+        prefetch_element(&this->elements[hash & (this->capacity - 1)]);
+        if (this->old_elements != nullptr) {
+            prefetch_element(&this->old_elements[hash & (this->old_capacity - 1)]);
+        }
+        return hash;
+    }
+
+    //    
+    void swap(HashTable& other) {
+        std::swap(elements, other.elements);
+        std::swap(capacity, other.capacity);
+        std::swap(size, other.size);
+        std::swap(count_deleted, other.count_deleted);
+        std::swap(hasher, other.hasher);
+        std::swap(equal, other.equal);
+        std::swap(incremental, other.incremental);
+        std::swap(old_elements, other.old_elements);
+        std::swap(old_capacity, other.old_capacity);
+        std::swap(migrate_index, other.migrate_index);
+        std::swap(next_elements, other.next_elements);
+        std::swap(next_constructed, other.next_constructed);
+    }
+
+    //   :  (second = false)  ,  ,
+    //   key  args.    ,  ,
+    //        
+    template <typename K, typename... Args>
+    std::pair<Element*, bool> try_insert(K&& key, Args&&... args) {
+        size_t hash = hasher(key);
+        return try_insert_hashed(hash, std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    //       
+    template <typename K, typename... Args>
+    std::pair<Element*, bool> try_insert_hashed(size_t hash, K&& key, Args&&... args) {
+        //          .
+        migrate(MIGRATE_STEP);
+        prepare(MIGRATE_STEP);
+
+        //        -   .
+        bool in_old = false;
+        Element* elem = find_element(key, hash, in_old);
+        if (elem != nullptr) {
+            return std::make_pair(elem, false);
+        }
+
+        // ,           .
+        //  ,     -    .
+        if (check_capacity()) {
+            resize();
+        }
+
+        //         .
+        bool not_found = true;
+        elem = &this->elements[algorithm(key, hash, this->elements, this->capacity, not_found)];
+
+        //       .
+        bool reused = elem->state == DELETED;
+        elem->~Element();
+        try {
+            new (elem) Element(std::piecewise_construct, std::forward<K>(key), std::forward<Args>(args)...);
+        }
+        catch (...) {
+            //     ,     
+            new (elem) Element();
+            elem->state = reused ? DELETED : EMPTY;
+            throw;
+        }
+        if (reused) {
+            this->count_deleted--;
+        }
+
+        //   - (  ).
+        this->size++;
+        return std::make_pair(elem, true);
+    }
+
+    template <typename K, typename V>
+    void add_value(K&& key, size_t hash, V&& value) {
+        std::pair<Element*, bool> result = try_insert_hashed(hash, std::forward<K>(key), std::forward<V>(value));
+        //    -  ,   .
+        if (!result.second) {
+            result.first->value = std::forward<V>(value);
+        }
+    }
+
 public:
     //   
-    HashTable()
-        : elements(new Array<Element>(16)), capacity(16), size(0), count_deleted(0) {}
+    explicit HashTable(const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : elements(create_elements(16)), capacity(16), size(0), count_deleted(0), hasher(hasher), equal(equal) {}
 
-    //  
+    //  .     ;
+    //       
     HashTable(const HashTable& other)
-        : elements(new Array<Element>(other.capacity)), capacity(other.capacity), size(other.size), count_deleted(other.count_deleted) {
-        //  
-        for (int i = 0; i < capacity; ++i) {
-            Element* elem = other.elements->get(i);
-            if (!elem->key.empty()) {
-                elements->set(i, *elem);
+        : elements(allocate_elements(other.capacity)), capacity(other.capacity), size(other.size),
+          count_deleted(other.count_deleted), hasher(other.hasher), equal(other.equal),
+          incremental(other.incremental), old_capacity(other.old_capacity), migrate_index(other.migrate_index) {
+        for (size_t i = 0; i < capacity; ++i) {
+            new (&elements[i]) Element(other.elements[i]);
+        }
+        if (other.old_elements != nullptr) {
+            old_elements = allocate_elements(old_capacity);
+            for (size_t i = migrate_index; i < old_capacity; ++i) {
+                new (&old_elements[i]) Element(other.old_elements[i]);
             }
         }
     }
@@ -232,83 +448,181 @@ public:
     //  
     HashTable& operator=(const HashTable& other) {
         if (this != &other) {
-            delete elements;
-
-            capacity = other.capacity;
-            size = other.size;
-            count_deleted = other.count_deleted;
-            elements = new Array<Element>(capacity);
-
-            for (int i = 0; i < capacity; ++i) {
-                Element* elem = other.elements->get(i);
-                if (!elem->key.empty()) {
-                    elements->set(i, *elem);
-                }
-            }
+            HashTable copy(other);
+            swap(copy);
         }
         return *this;
     }
 
     // 
     ~HashTable() {
-        delete elements;
+        destroy_elements(elements, 0, capacity);
+        destroy_elements(old_elements, migrate_index, old_capacity);
+        drop_next();
     }
 
-    //  
-    void add(const std::string& key, const std::string& value) {
-        // ,   ,       .
-        bool not_found = true;
+    //     .  
+    //    .
+    void set_incremental_resize(bool enabled) {
+        this->incremental = enabled;
+        if (!enabled) {
+            finish_migration();
+            drop_next();
+        }
+    }
 
-        //  -       .
-        int final_hash = algorithm(key, this->elements, this->capacity, not_found);
+    //        
+    bool is_resizing() const { return this->old_elements != nullptr; }
 
-        //         elements.
-        //        Element.
-        elements->set(final_hash, Element(key, value));
+    //  ;    
+    void add(const Key& key, const Value& value) {
+        add_value(key, hasher(key), value);
+    }
 
-        //   - (  ).
-        this->size++;
+    //          
+    void add(Key&& key, Value&& value) {
+        size_t hash = hasher(key);
+        add_value(std::move(key), hash, std::move(value));
+    }
 
-        // ,            .
-        //   ,     -    .
-        if (check_capacity()) {
-            //   resize    -   .
-            resize();
-        }
+    //     : hash    hasher(key).
+    //     ,     
+    // (,     ConcurrentHashTable)
+    void add(const Key& key, size_t hash, const Value& value) {
+        add_value(key, hash, value);
+    }
+
+    //  ,       args.    ,
+    //     args  .     ,  
+    // -   (, std::string_view   );  Key
+    //    .       
+    template <typename K, typename... Args>
+    std::pair<Value*, bool> emplace(K&& key, Args&&... args) {
+        std::pair<Element*, bool> result = try_insert(std::forward<K>(key), std::forward<Args>(args)...);
+        return std::make_pair(&result.first->value, result.second);
     }
 
     //  
-    void del(const std::string& key) {
-        //   ,   .
-        // find_index  -1,    .
-        int index_to_delete = find_index(key);
+    void del(const Key& key) {
+        del(key, hasher(key));
+    }
+
+    //      
+    void del(const Key& key, size_t hash) {
+        migrate(MIGRATE_STEP);
+        prepare(MIGRATE_STEP);
+
+        //  ,   ,    ,   .
+        bool in_old = false;
+        Element* elem = find_element(key, hash, in_old);
 
-        //     ,        ,
-        //      .
-        if (index_to_delete == -1) return;
+        //    ,        .
+        if (elem == nullptr) return;
 
-        //   ,      "".
-        //        ,
-        //      ,   'deleted'  true.
-        this->elements->get(index_to_delete)->deleted = true;
+        //    ,    ,
+        //       .
+        //   ,    .
+        elem->state = DELETED;
+        elem->value = Value();
 
-        //    .
+        this->size--;
+        //      .
         //      check_capacity  ,
         //     .
-        this->count_deleted++;
+        //        .
+        if (!in_old) {
+            this->count_deleted++;
+        }
     }
 
     //  
-    std::pair<bool, std::string> find(const std::string& key) {
-        //   find_index      .
-        int index = find_index(key);
+    //        ,    
+    //     add  del.
+    std::pair<bool, Value> find(const Key& key) const {
+        return find(key, hasher(key));
+    }
 
-        //  find_index  -1,        .
-        //     ,    - false,  -  .
-        if (index == -1) return std::make_pair(false, "");
+    //      
+    std::pair<bool, Value> find(const Key& key, size_t hash) const {
+        bool in_old = false;
+        Element* elem = find_element(key, hash, in_old);
+
+        //       ,    false    .
+        if (elem == nullptr) return std::make_pair(false, Value());
 
         //   ,  ,    - true,
         //   - ,   .
-        return std::make_pair(true, elements->get(index)->value);
+        return std::make_pair(true, elem->value);
+    }
+
+    //   :     nullptr,   .
+    //     ,   -  :   
+    //   std::string_view  const char*        .
+    //      
+    template <typename K>
+    Value* find_value(const K& key) {
+        bool in_old = false;
+        Element* elem = find_element(key, in_old);
+        return elem != nullptr ? &elem->value : nullptr;
+    }
+
+    template <typename K>
+    const Value* find_value(const K& key) const {
+        bool in_old = false;
+        const Element* elem = find_element(key, in_old);
+        return elem != nullptr ? &elem->value : nullptr;
+    }
+
+    //       
+    template <typename K>
+    Value* find_value(const K& key, size_t hash) {
+        bool in_old = false;
+        Element* elem = find_element(key, hash, in_old);
+        return elem != nullptr ? &elem->value : nullptr;
+    }
+
+    template <typename K>
+    const Value* find_value(const K& key, size_t hash) const {
+        bool in_old = false;
+        const Element* elem = find_element(key, hash, in_old);
+        return elem != nullptr ? &elem->value : nullptr;
+    }
+
+    //   : out[i] -    keys[i]  nullptr.
+    //    i,   i + PREFETCH_BATCH      
+    //  ( ),       .
+    //       .
+    //    
+    template <typename K>
+    size_t find_many(const K* keys, size_t n, const Value** out) const {
+        size_t hashes[PREFETCH_BATCH];
+        size_t found = 0;
+        size_t ahead = n < PREFETCH_BATCH ? n : PREFETCH_BATCH;
+        for (size_t i = 0; i < ahead; i++) {
+            hashes[i] = request(keys[i]);
+        }
+        for (size_t i = 0; i < n; i++) {
+            size_t hash = hashes[i % PREFETCH_BATCH];
+            if (i + PREFETCH_BATCH < n) {
+                hashes[i % PREFETCH_BATCH] = request(keys[i + PREFETCH_BATCH]);
+            }
+            bool in_old = false;
+            const Element* elem = find_element(keys[i], hash, in_old);
+            out[i] = elem != nullptr ? &elem->value : nullptr;
+            found += elem != nullptr;
+        }
+        return found;
     }
-};
\ No newline at end of file
+
+    //    
+    size_t get_size() const { return this->size; }
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t HashTable<Key, Value, Hash, KeyEqual>::NOT_FOUND;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t HashTable<Key, Value, Hash, KeyEqual>::MIGRATE_STEP;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t HashTable<Key, Value, Hash, KeyEqual>::PREFETCH_BATCH;
@@ -0,0 +1,164 @@
+#ifndef HASHFUNCTIONS_TEMPLATE_H
+#define HASHFUNCTIONS_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// -  -.    64-   :
+//        ,     
+//    ,    -  ,   .
+
+// 128-  a * b:     a,  -  b
+inline void hashMultiply(uint64_t& a, uint64_t& b) {
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    a = static_cast<uint64_t>(product);
+    b = static_cast<uint64_t>(product >> 64);
+#else
+    //    32- 
+    uint64_t aLow = a & 0xFFFFFFFFull, aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFFull, bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+    uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFull) + (highLow & 0xFFFFFFFFull);
+    a = (lowLow & 0xFFFFFFFFull) | (middle << 32);
+    b = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+#endif
+}
+
+//     128- ,   XOR
+inline uint64_t hashMultiplyMix(uint64_t a, uint64_t b) {
+    hashMultiply(a, b);
+    return a ^ b;
+}
+
+//  64-  ( splitmix64) -   
+inline uint64_t hashInteger(uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+namespace hashDetail {
+    //    wyhash: ,        
+    const uint64_t SECRET0 = 0xA0761D6478BD642Full;
+    const uint64_t SECRET1 = 0xE7037ED1A0B428DBull;
+    const uint64_t SECRET2 = 0x8EBC6AF09C88C6E3ull;
+    const uint64_t SECRET3 = 0x589965CC75374CC3ull;
+
+    //    memcpy:       
+    inline uint64_t read64(const unsigned char* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read32(const unsigned char* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    // 1-3 : ,     (  1  2  )
+    inline uint64_t read3(const unsigned char* p, size_t length) {
+        return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[length >> 1]) << 8) | p[length - 1];
+    }
+}
+
+//      wyhash.     48 
+//      ,  -  16 ;   16 
+//      .     
+// 64 x 64 -> 128       .
+//      .
+inline uint64_t hashBytes(const void* key, size_t length, uint64_t seed = 0) {
+    using namespace hashDetail;
+    const unsigned char* p = static_cast<const unsigned char*>(key);
+    seed ^= hashMultiplyMix(seed ^ SECRET0, SECRET1);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            //    4-       4-16
+            size_t shift = (length >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + shift);
+            b = (read32(p + length - 4) << 32) | read32(p + length - 4 - shift);
+        }
+        else if (length > 0) {
+            a = read3(p, length);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        size_t rest = length;
+        if (rest > 48) {
+            uint64_t seed1 = seed, seed2 = seed;
+            do {
+                seed = hashMultiplyMix(read64(p) ^ SECRET1, read64(p + 8) ^ seed);
+                seed1 = hashMultiplyMix(read64(p + 16) ^ SECRET2, read64(p + 24) ^ seed1);
+                seed2 = hashMultiplyMix(read64(p + 32) ^ SECRET3, read64(p + 40) ^ seed2);
+                p += 48;
+                rest -= 48;
+            } while (rest > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (rest > 16) {
+            seed = hashMultiplyMix(read64(p) ^ SECRET1, read64(p + 8) ^ seed);
+            p += 16;
+            rest -= 16;
+        }
+        //  16   (    )
+        a = read64(p + rest - 16);
+        b = read64(p + rest - 8);
+    }
+    a ^= SECRET1;
+    b ^= seed;
+    hashMultiply(a, b);
+    return hashMultiplyMix(a ^ SECRET0 ^ length, b ^ SECRET1);
+}
+
+//  
+inline uint64_t hashString(const char* data, size_t length) {
+    return hashBytes(data, length);
+}
+
+// -    -.    ,  
+//     ,    .
+//          size_t operator()(const Key&),
+//      : std::hash  , ,   .
+template <typename Key, typename Enable = void>
+struct DefaultHash {
+    size_t operator()(const Key& key) const {
+        return static_cast<size_t>(hashInteger(static_cast<uint64_t>(std::hash<Key>()(key))));
+    }
+};
+
+//  :     ,       
+template <typename Key>
+struct DefaultHash<Key, typename std::enable_if<std::is_integral<Key>::value>::type> {
+    size_t operator()(Key key) const {
+        return static_cast<size_t>(hashInteger(static_cast<uint64_t>(key)));
+    }
+};
+
+// :   std::string_view,  std::string, std::string_view  const char*
+//        ( )
+template <>
+struct DefaultHash<std::string> {
+    typedef void is_transparent;
+
+    size_t operator()(std::string_view key) const {
+        return static_cast<size_t>(hashString(key.data(), key.size()));
+    }
+};
+
+#endif // HASHFUNCTIONS_TEMPLATE_H
@@ -0,0 +1,213 @@
+#ifndef INDEXEDHEAP_TEMPLATE_H
+#define INDEXEDHEAP_TEMPLATE_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//  :  -   0 ... idCount - 1 (,   ),
+//    .         ,
+//          O(log n),
+//          :  O(idCount)  O(E)
+//     .
+template <typename Key, typename Compare = std::less<Key>>
+class IndexedHeap {
+public:
+    //  ,    
+    static const size_t NPOS = static_cast<size_t>(-1);
+
+    //    0 ... idCount - 1
+    explicit IndexedHeap(size_t idCount = 0, const Compare& compare = Compare())
+        : keys(idCount), positions(idCount, NPOS), compare(compare) {
+        heap.reserve(idCount);
+    }
+
+    //   ;   
+    void resize(size_t idCount) {
+        if (idCount < positions.size()) {
+            throw std::invalid_argument("IndexedHeap can't shrink");
+        }
+        keys.resize(idCount);
+        positions.resize(idCount, NPOS);
+    }
+
+    size_t idCount() const { return positions.size(); }
+
+    size_t size() const { return heap.size(); }
+
+    bool empty() const { return heap.empty(); }
+
+    bool contains(size_t id) const {
+        return id < positions.size() && positions[id] != NPOS;
+    }
+
+    //    ;       
+    void insert(size_t id, const Key& key) {
+        checkId(id);
+        if (positions[id] != NPOS) {
+            throw std::invalid_argument("Id is already in the heap");
+        }
+        keys[id] = key;
+        positions[id] = heap.size();
+        heap.push_back(id);
+        siftUp(heap.size() - 1);
+    }
+
+    //  ,    
+    const Key& getKey(size_t id) const {
+        checkContains(id);
+        return keys[id];
+    }
+
+    //   (   )
+    void decreaseKey(size_t id, const Key& key) {
+        checkContains(id);
+        if (compare(keys[id], key)) {
+            throw std::invalid_argument("New key is greater than the current one");
+        }
+        keys[id] = key;
+        siftUp(positions[id]);
+    }
+
+    //   (   )
+    void increaseKey(size_t id, const Key& key) {
+        checkContains(id);
+        if (compare(key, keys[id])) {
+            throw std::invalid_argument("New key is less than the current one");
+        }
+        keys[id] = key;
+        siftDown(positions[id]);
+    }
+
+    //       
+    void update(size_t id, const Key& key) {
+        if (!contains(id)) {
+            insert(id, key);
+        }
+        else if (compare(key, keys[id])) {
+            decreaseKey(id, key);
+        }
+        else {
+            increaseKey(id, key);
+        }
+    }
+
+    //   :      
+    void erase(size_t id) {
+        checkContains(id);
+        size_t index = positions[id];
+        positions[id] = NPOS;
+        size_t last = heap.back();
+        heap.pop_back();
+        if (index == heap.size()) {
+            return;
+        }
+        heap[index] = last;
+        positions[last] = index;
+        //      ,      
+        if (index > 0 && compare(keys[last], keys[heap[(index - 1) / 2]])) {
+            siftUp(index);
+        }
+        else {
+            siftDown(index);
+        }
+    }
+
+    //    
+    size_t getMinId() const {
+        checkNotEmpty();
+        return heap[0];
+    }
+
+    //  
+    const Key& getMinKey() const {
+        checkNotEmpty();
+        return keys[heap[0]];
+    }
+
+    //     
+    size_t extractMin() {
+        checkNotEmpty();
+        size_t id = heap[0];
+        erase(id);
+        return id;
+    }
+
+    //   ;   
+    void clear() {
+        for (size_t i = 0; i < heap.size(); i++) {
+            positions[heap[i]] = NPOS;
+        }
+        heap.clear();
+    }
+
+private:
+    std::vector<Key> keys;         //   
+    std::vector<size_t> positions; //    heap  NPOS
+    std::vector<size_t> heap;      //   
+    Compare compare;               //    
+
+    void checkId(size_t id) const {
+        if (id >= positions.size()) {
+            throw std::out_of_range("Id is out of range");
+        }
+    }
+
+    void checkContains(size_t id) const {
+        if (!contains(id)) {
+            throw std::out_of_range("Id is not in the heap");
+        }
+    }
+
+    void checkNotEmpty() const {
+        if (heap.empty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+    }
+
+    //   "":   ,      
+    void siftUp(size_t index) {
+        size_t id = heap[index];
+        while (index > 0) {
+            size_t parent = (index - 1) / 2;
+            if (!compare(keys[id], keys[heap[parent]])) {
+                break;
+            }
+            heap[index] = heap[parent];
+            positions[heap[index]] = index;
+            index = parent;
+        }
+        heap[index] = id;
+        positions[id] = index;
+    }
+
+    //     :       
+    void siftDown(size_t index) {
+        size_t id = heap[index];
+        size_t count = heap.size();
+        while (true) {
+            size_t child = 2 * index + 1;
+            if (child >= count) {
+                break;
+            }
+            if (child + 1 < count && compare(keys[heap[child + 1]], keys[heap[child]])) {
+                child++;
+            }
+            if (!compare(keys[heap[child]], keys[id])) {
+                break;
+            }
+            heap[index] = heap[child];
+            positions[heap[index]] = index;
+            index = child;
+        }
+        heap[index] = id;
+        positions[id] = index;
+    }
+};
+
+template <typename Key, typename Compare>
+const size_t IndexedHeap<Key, Compare>::NPOS;
+
+#endif // INDEXEDHEAP_TEMPLATE_H
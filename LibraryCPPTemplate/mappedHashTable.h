@@ -0,0 +1,286 @@
+#ifndef MAPPEDHASHTABLE_TEMPLATE_H
+#define MAPPEDHASHTABLE_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "hashFunctions.h"
+// MAPPED_HASH_TABLE_NO_MMAP  mmap      
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(MAPPED_HASH_TABLE_NO_MMAP)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_HASH_TABLE_MMAP
+#endif
+
+//   - ,     .
+//    ,     :
+//    (64 ): , , ,  ,  ;
+//    (24 ):  ,    ,    ;
+//   :      ,   .
+//       hash & (capacity - 1),  
+//   EMPTY.      ,    ;
+//         .
+//  - hashString  hashFunctions.h,      .
+
+namespace mapped_hash_table {
+    const char MAGIC[8] = { 'H', 'A', 'S', 'H', 'M', 'A', 'P', '1' };
+    const uint32_t VERSION = 1;
+    const uint64_t EMPTY = static_cast<uint64_t>(-1);
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t slot_size;
+        uint64_t capacity;
+        uint64_t size;
+        uint64_t heap_size;
+        uint64_t reserved[3];
+    };
+
+    struct Slot {
+        uint64_t hash;         //  
+        uint64_t offset;       //    ; EMPTY -  
+        uint32_t key_length;   //  
+        uint32_t value_length; //  
+    };
+}
+
+//  :         save.
+//  add     .
+class MappedHashTableBuilder {
+public:
+    MappedHashTableBuilder() {}
+
+    //  .         32 ,
+    //       (std::length_error),    
+    void add(std::string_view key, std::string_view value) {
+        if (key.size() > UINT32_MAX || value.size() > UINT32_MAX) {
+            throw std::length_error("Mapped hash table key or value is too long");
+        }
+        Record record;
+        record.offset = heap.size();
+        record.key_length = static_cast<uint32_t>(key.size());
+        record.value_length = static_cast<uint32_t>(value.size());
+        heap.insert(heap.end(), key.begin(), key.end());
+        heap.insert(heap.end(), value.begin(), value.end());
+        records.push_back(record);
+    }
+
+    //  ;   -  std::runtime_error
+    void save(const std::string& path) const {
+        using namespace mapped_hash_table;
+        //    3/4,     
+        uint64_t capacity = 16;
+        while (capacity * 3 < records.size() * 4) {
+            capacity *= 2;
+        }
+        uint64_t mask = capacity - 1;
+
+        std::vector<Slot> slots(capacity);
+        for (size_t i = 0; i < capacity; i++) {
+            slots[i].offset = EMPTY;
+        }
+        uint64_t size = 0;
+        for (size_t r = 0; r < records.size(); r++) {
+            const Record& record = records[r];
+            const char* key = heap.data() + record.offset;
+            uint64_t hash = hashString(key, record.key_length);
+            size_t index = hash & mask;
+            //       ;      
+            while (slots[index].offset != EMPTY
+                   && !(slots[index].hash == hash && slots[index].key_length == record.key_length
+                        && (record.key_length == 0
+                            || std::memcmp(heap.data() + slots[index].offset, key, record.key_length) == 0))) {
+                index = (index + 1) & mask;
+            }
+            if (slots[index].offset == EMPTY) {
+                size++;
+            }
+            slots[index].hash = hash;
+            slots[index].offset = record.offset;
+            slots[index].key_length = record.key_length;
+            slots[index].value_length = record.value_length;
+        }
+
+        //  :    ,   
+        std::vector<char> packed;
+        for (size_t i = 0; i < capacity; i++) {
+            Slot& slot = slots[i];
+            if (slot.offset != EMPTY) {
+                size_t length = (size_t)slot.key_length + slot.value_length;
+                const char* data = heap.data() + slot.offset;
+                slot.offset = packed.size();
+                packed.insert(packed.end(), data, data + length);
+            }
+        }
+
+        Header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.slot_size = sizeof(Slot);
+        header.capacity = capacity;
+        header.size = size;
+        header.heap_size = packed.size();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(slots.data()), (std::streamsize)(capacity * sizeof(Slot)));
+        file.write(packed.data(), (std::streamsize)packed.size());
+        file.close();
+        if (!file) {
+            throw std::runtime_error("Can't write hash table file " + path);
+        }
+    }
+
+private:
+    struct Record {
+        uint64_t offset;
+        uint32_t key_length;
+        uint32_t value_length;
+    };
+
+    std::vector<char> heap;      //     add 
+    std::vector<Record> records; //    
+};
+
+// -      MappedHashTableBuilder.
+//  POSIX-     (mmap):    ,
+//     ,      .
+//          .
+//      , find -    ;
+//    std::runtime_error.
+class MappedHashTable {
+public:
+    explicit MappedHashTable(const std::string& path) : data(nullptr), length(0), slots(nullptr), heap(nullptr) {
+        open(path);
+        try {
+            check();
+        }
+        catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    MappedHashTable(const MappedHashTable&) = delete;
+    MappedHashTable& operator=(const MappedHashTable&) = delete;
+
+    ~MappedHashTable() {
+        close();
+    }
+
+    //  ;       ,   
+    std::pair<bool, std::string_view> find(std::string_view key) const {
+        uint64_t hash = hashString(key.data(), key.size());
+        uint64_t mask = header.capacity - 1;
+        for (uint64_t index = hash & mask, probes = 0; probes < header.capacity; index = (index + 1) & mask, probes++) {
+            const mapped_hash_table::Slot& slot = slots[index];
+            if (slot.offset == mapped_hash_table::EMPTY) {
+                break;
+            }
+            if (slot.hash != hash || slot.key_length != key.size()) {
+                continue;
+            }
+            if (slot.offset > header.heap_size || header.heap_size - slot.offset < (uint64_t)slot.key_length + slot.value_length) {
+                throw std::runtime_error("Corrupted hash table file");
+            }
+            const char* record = heap + slot.offset;
+            if (key.empty() || std::memcmp(record, key.data(), key.size()) == 0) {
+                return std::make_pair(true, std::string_view(record + slot.key_length, slot.value_length));
+            }
+        }
+        return std::make_pair(false, std::string_view());
+    }
+
+    //    
+    size_t get_size() const { return (size_t)header.size; }
+
+    //  
+    size_t get_capacity() const { return (size_t)header.capacity; }
+
+private:
+    const char* data;               //  
+    size_t length;                  //  
+    mapped_hash_table::Header header;
+    const mapped_hash_table::Slot* slots;
+    const char* heap;
+#ifndef MAPPED_HASH_TABLE_MMAP
+    std::vector<char> buffer;       //  ,  mmap 
+#endif
+
+#ifdef MAPPED_HASH_TABLE_MMAP
+    void open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Can't open hash table file " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Can't open hash table file " + path);
+        }
+        length = (size_t)info.st_size;
+        void* mapping = length > 0 ? mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        //       
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Can't map hash table file " + path);
+        }
+        data = static_cast<const char*>(mapping);
+    }
+
+    void close() {
+        if (data != nullptr) {
+            munmap(const_cast<char*>(data), length);
+            data = nullptr;
+        }
+    }
+#else
+    void open(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw std::runtime_error("Can't open hash table file " + path);
+        }
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        length = buffer.size();
+        data = buffer.data();
+    }
+
+    void close() {
+        buffer.clear();
+        data = nullptr;
+    }
+#endif
+
+    //     ;     
+    void check() {
+        using namespace mapped_hash_table;
+        if (length < sizeof(Header)) {
+            throw std::runtime_error("Hash table file is too short");
+        }
+        std::memcpy(&header, data, sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION
+            || header.slot_size != sizeof(Slot)) {
+            throw std::runtime_error("Unknown hash table file format");
+        }
+        if (header.capacity == 0 || (header.capacity & (header.capacity - 1)) != 0 || header.size > header.capacity
+            || header.capacity > (length - sizeof(Header)) / sizeof(Slot)
+            || header.heap_size != length - sizeof(Header) - header.capacity * sizeof(Slot)) {
+            throw std::runtime_error("Corrupted hash table file");
+        }
+        slots = reinterpret_cast<const Slot*>(data + sizeof(Header));
+        heap = data + sizeof(Header) + header.capacity * sizeof(Slot);
+    }
+};
+
+#endif // MAPPEDHASHTABLE_TEMPLATE_H
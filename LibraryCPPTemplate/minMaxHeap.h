@@ -0,0 +1,167 @@
+#ifndef MINMAXHEAP_TEMPLATE_H
+#define MINMAXHEAP_TEMPLATE_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Min-max :      O(1),     -  O(log n).
+//          .  :
+//   ( -  0)      ,   -  .
+//   - ,   -     .
+template <typename Data, typename Compare = std::less<Data>>
+class MinMaxHeap {
+public:
+    explicit MinMaxHeap(const Compare& compare = Compare()) : compare(compare) {}
+
+    void insert(const Data& value) {
+        data.push_back(value);
+        pushUp(data.size() - 1);
+    }
+
+    void insert(Data&& value) {
+        data.push_back(std::move(value));
+        pushUp(data.size() - 1);
+    }
+
+    const Data& getMin() const {
+        checkNotEmpty();
+        return data[0];
+    }
+
+    const Data& getMax() const {
+        checkNotEmpty();
+        return data[maxIndex()];
+    }
+
+    Data extractMin() {
+        checkNotEmpty();
+        return extractAt(0);
+    }
+
+    Data extractMax() {
+        checkNotEmpty();
+        return extractAt(maxIndex());
+    }
+
+    size_t size() const { return data.size(); }
+
+    bool empty() const { return data.empty(); }
+
+    void reserve(size_t capacity) { data.reserve(capacity); }
+
+    void clear() { data.clear(); }
+
+private:
+    std::vector<Data> data; //  
+    Compare compare;        //   
+
+    void checkNotEmpty() const {
+        if (data.empty()) {
+            throw std::out_of_range("Heap is empty");
+        }
+    }
+
+    //   min-,    (    index + 1,  ) 
+    static bool isMinLevel(size_t index) {
+        size_t level = 0;
+        for (size_t i = index + 1; i > 1; i >>= 1) {
+            level++;
+        }
+        return level % 2 == 0;
+    }
+
+    //   :  min- ""  ,  max- - 
+    bool better(const Data& a, const Data& b, bool minLevel) const {
+        return minLevel ? compare(a, b) : compare(b, a);
+    }
+
+    size_t maxIndex() const {
+        if (data.size() == 1) {
+            return 0;
+        }
+        if (data.size() == 2) {
+            return 1;
+        }
+        return compare(data[1], data[2]) ? 2 : 1;
+    }
+
+    //        
+    Data extractAt(size_t index) {
+        Data result = std::move(data[index]);
+        if (index + 1 < data.size()) {
+            data[index] = std::move(data.back());
+            data.pop_back();
+            pushDown(index);
+        }
+        else {
+            data.pop_back();
+        }
+        return result;
+    }
+
+    //     ,  ,    (min  max)  
+    void pushUp(size_t index) {
+        if (index == 0) {
+            return;
+        }
+        size_t parent = (index - 1) / 2;
+        bool minLevel = isMinLevel(index);
+        if (better(data[parent], data[index], minLevel)) {
+            //     :         
+            std::swap(data[index], data[parent]);
+            pushUpLevels(parent, !minLevel);
+        }
+        else {
+            pushUpLevels(index, minLevel);
+        }
+    }
+
+    //    -  ,    
+    void pushUpLevels(size_t index, bool minLevel) {
+        while (index > 2) {
+            size_t grandparent = ((index - 1) / 2 - 1) / 2;
+            if (!better(data[index], data[grandparent], minLevel)) {
+                break;
+            }
+            std::swap(data[index], data[grandparent]);
+            index = grandparent;
+        }
+    }
+
+    // :         
+    void pushDown(size_t index) {
+        bool minLevel = isMinLevel(index);
+        size_t count = data.size();
+        while (2 * index + 1 < count) {
+            size_t best = 2 * index + 1;
+            if (best + 1 < count && better(data[best + 1], data[best], minLevel)) {
+                best = best + 1;
+            }
+            size_t firstGrandchild = 4 * index + 3;
+            for (size_t i = firstGrandchild; i < firstGrandchild + 4 && i < count; i++) {
+                if (better(data[i], data[best], minLevel)) {
+                    best = i;
+                }
+            }
+            if (!better(data[best], data[index], minLevel)) {
+                break;
+            }
+            std::swap(data[best], data[index]);
+            if (best < firstGrandchild) {
+                //      ,      
+                break;
+            }
+            //     ; ,   ,    
+            size_t parent = (best - 1) / 2;
+            if (better(data[parent], data[best], minLevel)) {
+                std::swap(data[parent], data[best]);
+            }
+            index = best;
+        }
+    }
+};
+
+#endif // MINMAXHEAP_TEMPLATE_H
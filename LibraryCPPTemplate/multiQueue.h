@@ -0,0 +1,146 @@
+#ifndef MULTIQUEUE_TEMPLATE_H
+#define MULTIQUEUE_TEMPLATE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "binaryHeap.h"
+
+//       (MultiQueue).
+//       - queueCount  ,    .
+//     ,   choices        .
+//     ,     O(queueCount) :
+//     ,          .
+//     (try_lock):    .
+template <typename Data, typename Compare = std::less<Data>>
+class MultiQueue {
+public:
+    // threads -   , queuesPerThread -  c (  ),
+    // choices -      (1 -   )
+    explicit MultiQueue(size_t threads, size_t queuesPerThread = 2, size_t choices = 2,
+                        const Compare& compare = Compare())
+        : choices(choices < 1 ? 1 : choices), compare(compare), count(0) {
+        size_t queueCount = threads * queuesPerThread;
+        if (queueCount < 2) {
+            queueCount = 2;
+        }
+        shards.reserve(queueCount);
+        for (size_t i = 0; i < queueCount; i++) {
+            shards.push_back(std::unique_ptr<Shard>(new Shard(compare)));
+        }
+    }
+
+    MultiQueue(const MultiQueue&) = delete;
+    MultiQueue& operator=(const MultiQueue&) = delete;
+
+    //      
+    void insert(const Data& value) {
+        while (true) {
+            Shard& shard = *shards[random() % shards.size()];
+            std::unique_lock<std::mutex> lock(shard.mutex, std::try_to_lock);
+            if (!lock.owns_lock()) {
+                continue;
+            }
+            shard.heap.insert(value);
+            shard.size.store(shard.heap.size(), std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    //     .
+    //  false,         
+    bool tryExtractMin(Data& result) {
+        //  :   choices ,  
+        for (size_t attempt = 0; attempt < 4 * shards.size(); attempt++) {
+            if (count.load(std::memory_order_relaxed) == 0) {
+                break;
+            }
+            if (extractFromSample(result)) {
+                return true;
+            }
+        }
+        //    :        
+        for (size_t i = 0; i < shards.size(); i++) {
+            Shard& shard = *shards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (!shard.heap.empty()) {
+                takeMin(shard, result);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //    (,    )
+    size_t size() const { return count.load(std::memory_order_relaxed); }
+
+    bool empty() const { return size() == 0; }
+
+    size_t getQueueCount() const { return shards.size(); }
+
+private:
+    //    ;       -,
+    //        
+    struct Shard {
+        std::mutex mutex;
+        BinaryHeap<Data, Compare> heap;
+        std::atomic<size_t> size; //       
+        char padding[64];
+
+        explicit Shard(const Compare& compare) : heap(compare), size(0) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    size_t choices;
+    Compare compare;
+    std::atomic<size_t> count;
+
+    //   xorshift      
+    static uint64_t random() {
+        static thread_local uint64_t state =
+            std::hash<std::thread::id>()(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ull | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    void takeMin(Shard& shard, Data& result) {
+        result = shard.heap.extractMin();
+        shard.size.store(shard.heap.size(), std::memory_order_relaxed);
+        count.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    //  :   choices       
+    bool extractFromSample(Data& result) {
+        Shard* best = nullptr;
+        std::unique_lock<std::mutex> bestLock;
+        for (size_t i = 0; i < choices; i++) {
+            Shard* shard = shards[random() % shards.size()].get();
+            if (shard == best || shard->size.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(shard->mutex, std::try_to_lock);
+            if (!lock.owns_lock() || shard->heap.empty()) {
+                continue;
+            }
+            if (best == nullptr || compare(shard->heap.getMin(), best->heap.getMin())) {
+                best = shard;
+                bestLock = std::move(lock);
+            }
+        }
+        if (best == nullptr) {
+            return false;
+        }
+        takeMin(*best, result);
+        return true;
+    }
+};
+
+#endif // MULTIQUEUE_TEMPLATE_H
@@ -0,0 +1,304 @@
+#ifndef PAIRINGHEAP_TEMPLATE_H
+#define PAIRINGHEAP_TEMPLATE_H
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//   (pairing heap) -      .
+// ,     - O(1),   - O(log n)  .
+//   -  ;     (Handle) ,
+//         .  ,
+//    ,         .
+//
+//    :   ,      .
+//        ,     .
+template <typename Data, typename Compare = std::less<Data>>
+class PairingHeap {
+    struct Node;
+
+public:
+    //   
+    typedef Node* Handle;
+
+    explicit PairingHeap(const Compare& compare = Compare())
+        : root(nullptr), count(0), freeHead(nullptr), freeTail(nullptr), nextChunkSize(MIN_CHUNK), compare(compare) {}
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    PairingHeap(PairingHeap&& other) noexcept
+        : root(other.root), count(other.count), chunks(std::move(other.chunks)), freeHead(other.freeHead),
+          freeTail(other.freeTail), nextChunkSize(other.nextChunkSize), compare(std::move(other.compare)) {
+        other.root = nullptr;
+        other.count = 0;
+        other.chunks.clear();
+        other.freeHead = nullptr;
+        other.freeTail = nullptr;
+    }
+
+    ~PairingHeap() {
+        clear();
+        for (size_t i = 0; i < chunks.size(); i++) {
+            ::operator delete(chunks[i]);
+        }
+    }
+
+    //  ;    decreaseKey  erase
+    Handle insert(const Data& value) {
+        Node* node = allocateNode();
+        try {
+            new (node->storage()) Data(value);
+        }
+        catch (...) {
+            releaseNode(node);
+            throw;
+        }
+        root = root ? link(root, node) : node;
+        count++;
+        return node;
+    }
+
+    const Data& getMin() const {
+        checkNotEmpty();
+        return root->value();
+    }
+
+    //    
+    static const Data& getValue(Handle handle) {
+        return handle->value();
+    }
+
+    Data extractMin() {
+        checkNotEmpty();
+        Node* oldRoot = root;
+        root = combineSiblings(oldRoot->child);
+        count--;
+        Data result = std::move(oldRoot->value());
+        destroyNode(oldRoot);
+        return result;
+    }
+
+    //  :           
+    void decreaseKey(Handle handle, const Data& value) {
+        if (compare(handle->value(), value)) {
+            throw std::invalid_argument("New key is greater than the current one");
+        }
+        handle->value() = value;
+        if (handle == root) {
+            return;
+        }
+        cut(handle);
+        root = link(root, handle);
+    }
+
+    //   
+    void erase(Handle handle) {
+        if (handle == root) {
+            root = combineSiblings(root->child);
+        }
+        else {
+            cut(handle);
+            Node* children = combineSiblings(handle->child);
+            if (children) {
+                root = link(root, children);
+            }
+        }
+        count--;
+        destroyNode(handle);
+    }
+
+    //   O(1):         ,   .
+    //            
+    void merge(PairingHeap& other) {
+        if (&other == this) {
+            return;
+        }
+        if (other.root) {
+            root = root ? link(root, other.root) : other.root;
+        }
+        count += other.count;
+        chunks.insert(chunks.end(), other.chunks.begin(), other.chunks.end());
+        if (other.freeHead) {
+            if (freeTail) {
+                freeTail->sibling = other.freeHead;
+            }
+            else {
+                freeHead = other.freeHead;
+            }
+            freeTail = other.freeTail;
+        }
+        other.root = nullptr;
+        other.count = 0;
+        other.chunks.clear();
+        other.freeHead = nullptr;
+        other.freeTail = nullptr;
+        other.nextChunkSize = MIN_CHUNK;
+    }
+
+    size_t size() const { return count; }
+
+    bool empty() const { return count == 0; }
+
+    //   ;    
+    void clear() {
+        std::vector<Node*> stack;
+        if (root) {
+            stack.push_back(root);
+        }
+        while (!stack.empty()) {
+            Node* node = stack.back();
+            stack.pop_back();
+            if (node->child) {
+                stack.push_back(node->child);
+            }
+            if (node->sibling) {
+                stack.push_back(node->sibling);
+            }
+            destroyNode(node);
+        }
+        root = nullptr;
+        count = 0;
+    }
+
+private:
+    static const size_t MIN_CHUNK = 64;
+    static const size_t MAX_CHUNK = 4096;
+
+    //  :  ,    prev -       .
+    //     ,        Data
+    struct Node {
+        Node* child;
+        Node* sibling;
+        Node* prev;
+        alignas(Data) unsigned char buffer[sizeof(Data)];
+
+        void* storage() { return buffer; }
+        Data& value() { return *reinterpret_cast<Data*>(buffer); }
+        const Data& value() const { return *reinterpret_cast<const Data*>(buffer); }
+    };
+
+    Node* root;                 //  -  
+    size_t count;               //  
+    std::vector<void*> chunks;  //   
+    Node* freeHead;             //    ( sibling)
+    Node* freeTail;             //   ,     O(1)
+    size_t nextChunkSize;       //     
+    Compare compare;            //   
+    std::vector<Node*> pairs;   //    combineSiblings
+
+    void checkNotEmpty() const {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+    }
+
+    //    ;     ,   
+    Node* allocateNode() {
+        if (!freeHead) {
+            size_t chunkSize = nextChunkSize;
+            Node* chunk = static_cast<Node*>(::operator new(chunkSize * sizeof(Node)));
+            chunks.push_back(chunk);
+            for (size_t i = 0; i < chunkSize; i++) {
+                chunk[i].sibling = i + 1 < chunkSize ? chunk + i + 1 : nullptr;
+            }
+            freeHead = chunk;
+            freeTail = chunk + chunkSize - 1;
+            if (nextChunkSize < MAX_CHUNK) {
+                nextChunkSize *= 2;
+            }
+        }
+        Node* node = freeHead;
+        freeHead = node->sibling;
+        if (!freeHead) {
+            freeTail = nullptr;
+        }
+        node->child = nullptr;
+        node->sibling = nullptr;
+        node->prev = nullptr;
+        return node;
+    }
+
+    void releaseNode(Node* node) {
+        node->sibling = freeHead;
+        freeHead = node;
+        if (!freeTail) {
+            freeTail = node;
+        }
+    }
+
+    void destroyNode(Node* node) {
+        node->value().~Data();
+        releaseNode(node);
+    }
+
+    //   :        
+    Node* link(Node* first, Node* second) {
+        if (compare(second->value(), first->value())) {
+            std::swap(first, second);
+        }
+        second->sibling = first->child;
+        if (first->child) {
+            first->child->prev = second;
+        }
+        second->prev = first;
+        first->child = second;
+        first->sibling = nullptr;
+        first->prev = nullptr;
+        return first;
+    }
+
+    //        
+    void cut(Node* node) {
+        if (node->prev->child == node) {
+            node->prev->child = node->sibling;
+        }
+        else {
+            node->prev->sibling = node->sibling;
+        }
+        if (node->sibling) {
+            node->sibling->prev = node->prev;
+        }
+        node->sibling = nullptr;
+        node->prev = nullptr;
+    }
+
+    //    :   ,    
+    Node* combineSiblings(Node* first) {
+        if (!first) {
+            return nullptr;
+        }
+        while (first) {
+            Node* a = first;
+            Node* b = a->sibling;
+            if (!b) {
+                a->prev = nullptr;
+                pairs.push_back(a);
+                break;
+            }
+            first = b->sibling;
+            a->sibling = nullptr;
+            a->prev = nullptr;
+            b->sibling = nullptr;
+            b->prev = nullptr;
+            pairs.push_back(link(a, b));
+        }
+        Node* result = pairs.back();
+        for (size_t i = pairs.size() - 1; i > 0; i--) {
+            result = link(pairs[i - 1], result);
+        }
+        pairs.clear();
+        return result;
+    }
+};
+
+template <typename Data, typename Compare>
+const size_t PairingHeap<Data, Compare>::MIN_CHUNK;
+
+template <typename Data, typename Compare>
+const size_t PairingHeap<Data, Compare>::MAX_CHUNK;
+
+#endif // PAIRINGHEAP_TEMPLATE_H
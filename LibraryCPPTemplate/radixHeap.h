@@ -0,0 +1,178 @@
+#ifndef RADIXHEAP_TEMPLATE_H
+#define RADIXHEAP_TEMPLATE_H
+
+#include <climits>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//     :    ,   
+//     (     - ).
+//        ,   : insert / extractMin.
+
+//  .  i > 0  ,      
+//    - (i - 1)-;  0 - ,   .
+//    0      ,
+//      Bits :  O(1),  O(log C)  .
+template <typename Value, typename Key = unsigned int>
+class RadixHeap {
+    static_assert(std::is_unsigned<Key>::value, "RadixHeap key must be an unsigned integer");
+
+public:
+    RadixHeap() : last(0), count(0) {}
+
+    //  ;       
+    void insert(Key key, const Value& value) {
+        if (key < last) {
+            throw std::invalid_argument("RadixHeap key is less than the last extracted one");
+        }
+        buckets[bucketIndex(key)].push_back(std::make_pair(key, value));
+        count++;
+    }
+
+    //  
+    Key getMinKey() {
+        prepareMin();
+        return buckets[0].back().first;
+    }
+
+    //      (  - )
+    std::pair<Key, Value> extractMin() {
+        prepareMin();
+        std::pair<Key, Value> result = std::move(buckets[0].back());
+        buckets[0].pop_back();
+        count--;
+        return result;
+    }
+
+    size_t size() const { return count; }
+
+    bool empty() const { return count == 0; }
+
+    //        
+    void clear() {
+        for (size_t i = 0; i < BUCKETS; i++) {
+            buckets[i].clear();
+        }
+        last = 0;
+        count = 0;
+    }
+
+private:
+    static const size_t BITS = sizeof(Key) * CHAR_BIT;
+    static const size_t BUCKETS = BITS + 1;
+
+    std::vector<std::pair<Key, Value>> buckets[BUCKETS]; //     
+    Key last;     //    (     )
+    size_t count; //  
+
+    //  : 0  ,  last,      + 1
+    size_t bucketIndex(Key key) const {
+        Key diff = key ^ last;
+        if (diff == 0) {
+            return 0;
+        }
+#if defined(__GNUC__)
+        return sizeof(unsigned long long) * CHAR_BIT - __builtin_clzll(static_cast<unsigned long long>(diff));
+#else
+        size_t index = 0;
+        while (diff) {
+            diff >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+
+    //      0
+    void prepareMin() {
+        if (count == 0) {
+            throw std::out_of_range("Heap is empty");
+        }
+        if (!buckets[0].empty()) {
+            return;
+        }
+        size_t index = 1;
+        while (buckets[index].empty()) {
+            index++;
+        }
+        //    -   ,       
+        Key minimum = buckets[index][0].first;
+        for (size_t i = 1; i < buckets[index].size(); i++) {
+            if (buckets[index][i].first < minimum) {
+                minimum = buckets[index][i].first;
+            }
+        }
+        last = minimum;
+        std::vector<std::pair<Key, Value>> moved;
+        moved.swap(buckets[index]);
+        for (size_t i = 0; i < moved.size(); i++) {
+            buckets[bucketIndex(moved[i].first)].push_back(std::move(moved[i]));
+        }
+        //      
+        moved.clear();
+        buckets[index].swap(moved);
+    }
+};
+
+template <typename Value, typename Key>
+const size_t RadixHeap<Value, Key>::BITS;
+
+template <typename Value, typename Key>
+const size_t RadixHeap<Value, Key>::BUCKETS;
+
+//  -   :       
+// [last, last + maxStep],   maxStep + 1   .
+//  O(1),  - O(1)     (  maxStep ).
+template <typename Value>
+class DialQueue {
+public:
+    // maxStep -         (  )
+    explicit DialQueue(size_t maxStep) : buckets(maxStep + 1), last(0), current(0), count(0) {}
+
+    void insert(size_t key, const Value& value) {
+        if (key < last || key - last >= buckets.size()) {
+            throw std::invalid_argument("DialQueue key is out of the allowed range");
+        }
+        buckets[(current + (key - last)) % buckets.size()].push_back(std::make_pair(key, value));
+        count++;
+    }
+
+    size_t getMinKey() {
+        prepareMin();
+        return last;
+    }
+
+    std::pair<size_t, Value> extractMin() {
+        prepareMin();
+        std::pair<size_t, Value> result = std::move(buckets[current].back());
+        buckets[current].pop_back();
+        count--;
+        return result;
+    }
+
+    size_t size() const { return count; }
+
+    bool empty() const { return count == 0; }
+
+private:
+    std::vector<std::vector<std::pair<size_t, Value>>> buckets; //   last ... last + maxStep
+    size_t last;    //   current
+    size_t current; //    
+    size_t count;   //  
+
+    //       
+    void prepareMin() {
+        if (count == 0) {
+            throw std::out_of_range("Queue is empty");
+        }
+        while (buckets[current].empty()) {
+            current = (current + 1) % buckets.size();
+            last++;
+        }
+    }
+};
+
+#endif // RADIXHEAP_TEMPLATE_H
@@ -0,0 +1,188 @@
+#ifndef ROBINHOODHASHTABLE_TEMPLATE_H
+#define ROBINHOODHASHTABLE_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+#include "hashFunctions.h"
+
+// - Robin Hood:  ,      
+//  ,       (" "),     .
+//    ,         .
+//           (0 -  ).
+//
+//  ,        :
+//     .     :  
+//       (backward shift).  ,  
+//     ,     ,  
+//    80% .
+//
+//    HashTable: add, del, find  get_size.
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>, typename KeyEqual = std::equal_to<Key>>
+class RobinHoodHashTable {
+public:
+    explicit RobinHoodHashTable(const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : slots(nullptr), capacity(0), size(0), hasher(hasher), equal(equal) {
+        allocate(MIN_CAPACITY);
+    }
+
+    RobinHoodHashTable(const RobinHoodHashTable&) = delete;
+    RobinHoodHashTable& operator=(const RobinHoodHashTable&) = delete;
+
+    ~RobinHoodHashTable() {
+        destroy();
+    }
+
+    //  ;    
+    void add(const Key& key, const Value& value) {
+        size_t hash = hasher(key);
+        size_t index = find_index(key, hash);
+        if (index != NOT_FOUND) {
+            slots[index].value = value;
+            return;
+        }
+        if ((size + 1) * 5 > capacity * 4) {
+            rehash(capacity * 2);
+        }
+        insert_new(Slot(key, value), hash);
+        size++;
+    }
+
+    //        
+    void del(const Key& key) {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return;
+        size_t mask = capacity - 1;
+        slots[index].~Slot();
+        size_t next = (index + 1) & mask;
+        //    1      -    
+        while (distances[next] > 1) {
+            new (&slots[index]) Slot(std::move(slots[next]));
+            slots[next].~Slot();
+            distances[index] = distances[next] - 1;
+            index = next;
+            next = (next + 1) & mask;
+        }
+        distances[index] = 0;
+        size--;
+    }
+
+    //  
+    std::pair<bool, Value> find(const Key& key) const {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return std::make_pair(false, Value());
+        return std::make_pair(true, slots[index].value);
+    }
+
+    //    
+    size_t get_size() const { return size; }
+
+    //  
+    size_t get_capacity() const { return capacity; }
+
+    //    index      ; 0 -  
+    size_t get_distance(size_t index) const { return distances[index]; }
+
+    //       (   )
+    size_t get_max_distance() const {
+        size_t result = 0;
+        for (size_t i = 0; i < capacity; i++) {
+            if (distances[i] > result) {
+                result = distances[i];
+            }
+        }
+        return result;
+    }
+
+private:
+    static const size_t MIN_CAPACITY = 16;
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    struct Slot {
+        Key key;
+        Value value;
+
+        Slot(const Key& key, const Value& value) : key(key), value(value) {}
+    };
+
+    std::vector<uint32_t> distances; //      ; 0 -  
+    Slot* slots;                     // ;    
+    size_t capacity;                 //  ( )
+    size_t size;                     //  
+    Hash hasher;                     // - 
+    KeyEqual equal;                  //  
+
+    size_t find_index(const Key& key, size_t hash) const {
+        size_t mask = capacity - 1;
+        size_t index = hash & mask;
+        //          -   
+        for (uint32_t distance = 1; distances[index] >= distance; distance++) {
+            if (distances[index] == distance && equal(slots[index].key, key)) {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        return NOT_FOUND;
+    }
+
+    //  ,    ;    
+    void insert_new(Slot slot, size_t hash) {
+        size_t mask = capacity - 1;
+        size_t index = hash & mask;
+        uint32_t distance = 1;
+        while (distances[index] != 0) {
+            //       ,  :   
+            //     
+            if (distances[index] < distance) {
+                std::swap(slot, slots[index]);
+                std::swap(distance, distances[index]);
+            }
+            index = (index + 1) & mask;
+            distance++;
+        }
+        new (&slots[index]) Slot(std::move(slot));
+        distances[index] = distance;
+    }
+
+    void allocate(size_t new_capacity) {
+        distances.assign(new_capacity, 0);
+        slots = static_cast<Slot*>(::operator new(new_capacity * sizeof(Slot)));
+        capacity = new_capacity;
+    }
+
+    void destroy() {
+        for (size_t i = 0; i < capacity; i++) {
+            if (distances[i] != 0) {
+                slots[i].~Slot();
+            }
+        }
+        ::operator delete(slots);
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<uint32_t> old_distances;
+        old_distances.swap(distances);
+        Slot* old_slots = slots;
+        size_t old_capacity = capacity;
+        allocate(new_capacity);
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_distances[i] != 0) {
+                size_t hash = hasher(old_slots[i].key);
+                insert_new(std::move(old_slots[i]), hash);
+                old_slots[i].~Slot();
+            }
+        }
+        ::operator delete(old_slots);
+    }
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t RobinHoodHashTable<Key, Value, Hash, KeyEqual>::MIN_CAPACITY;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t RobinHoodHashTable<Key, Value, Hash, KeyEqual>::NOT_FOUND;
+
+#endif // ROBINHOODHASHTABLE_TEMPLATE_H
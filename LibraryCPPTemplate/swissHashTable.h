@@ -0,0 +1,288 @@
+#ifndef SWISSHASHTABLE_TEMPLATE_H
+#define SWISSHASHTABLE_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+#include "hashFunctions.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// -         ( Swiss table).
+//      : 7        
+// / .       16 
+// (  SSE2   )        
+// 7  -       128 .   
+//           .
+//  SSE2    .
+//
+//    HashTable: add, del, find  get_size.
+//       7/8,  -  .
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>, typename KeyEqual = std::equal_to<Key>>
+class SwissHashTable {
+public:
+    explicit SwissHashTable(const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : slots(nullptr), capacity(0), size(0), count_deleted(0), growth_left(0), hasher(hasher), equal(equal) {
+        allocate(MIN_CAPACITY);
+    }
+
+    SwissHashTable(const SwissHashTable&) = delete;
+    SwissHashTable& operator=(const SwissHashTable&) = delete;
+
+    ~SwissHashTable() {
+        destroy();
+    }
+
+    //  ;    
+    void add(const Key& key, const Value& value) {
+        size_t hash = hasher(key);
+        size_t index = find_index(key, hash);
+        if (index != NOT_FOUND) {
+            slots[index].value = value;
+            return;
+        }
+        if (growth_left == 0) {
+            grow();
+        }
+        index = find_insert_slot(hash);
+        new (&slots[index]) Slot(key, value);
+        if (ctrl[index] == DELETED) {
+            count_deleted--;
+        }
+        else {
+            growth_left--;
+        }
+        set_ctrl(index, h2(hash));
+        size++;
+    }
+
+    //  
+    void del(const Key& key) {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return;
+        slots[index].~Slot();
+        size--;
+        //       16       ,   ,
+        //   ,    ,       
+        // .     ,   ,    .
+        size_t before = (index - GROUP) & (capacity - 1);
+        unsigned empty_after = match_empty(&ctrl[index]);
+        unsigned empty_before = match_empty(&ctrl[before]);
+        if (empty_after && empty_before && trailing_zeros(empty_after) + leading_zeros(empty_before) < GROUP) {
+            set_ctrl(index, EMPTY);
+            growth_left++;
+        }
+        else {
+            set_ctrl(index, DELETED);
+            count_deleted++;
+        }
+    }
+
+    //  
+    std::pair<bool, Value> find(const Key& key) const {
+        size_t index = find_index(key, hasher(key));
+        if (index == NOT_FOUND) return std::make_pair(false, Value());
+        return std::make_pair(true, slots[index].value);
+    }
+
+    //    
+    size_t get_size() const { return size; }
+
+    //  
+    size_t get_capacity() const { return capacity; }
+
+    //   ,    
+    size_t get_deleted() const { return count_deleted; }
+
+private:
+    static const size_t GROUP = 16;
+    static const size_t MIN_CAPACITY = 16;
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    //  :   - 7   (0 ... 127),   -  
+    static const signed char EMPTY = -128;
+    static const signed char DELETED = -2;
+
+    struct Slot {
+        Key key;
+        Value value;
+
+        Slot(const Key& key, const Value& value) : key(key), value(value) {}
+    };
+
+    // capacity + GROUP  :  GROUP - 1  ,
+    //             
+    std::vector<signed char> ctrl;
+    Slot* slots;            // ;    
+    size_t capacity;        //  ( )
+    size_t size;            //  
+    size_t count_deleted;   //   
+    size_t growth_left;     //        
+    Hash hasher;            // - 
+    KeyEqual equal;         //  
+
+    //   -   ,   - 7 
+    static size_t h1(size_t hash) { return hash >> 7; }
+    static signed char h2(size_t hash) { return static_cast<signed char>(hash & 0x7F); }
+
+#ifdef __SSE2__
+    //    ,     value
+    static unsigned match(const signed char* group, signed char value) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(value))));
+    }
+
+    //     -     
+    static unsigned match_free(const signed char* group) {
+        return static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+    }
+#else
+    static unsigned match(const signed char* group, signed char value) {
+        unsigned mask = 0;
+        for (size_t i = 0; i < GROUP; i++) {
+            mask |= static_cast<unsigned>(group[i] == value) << i;
+        }
+        return mask;
+    }
+
+    static unsigned match_free(const signed char* group) {
+        unsigned mask = 0;
+        for (size_t i = 0; i < GROUP; i++) {
+            mask |= static_cast<unsigned>(group[i] < 0) << i;
+        }
+        return mask;
+    }
+#endif
+
+    static unsigned match_empty(const signed char* group) {
+        return match(group, EMPTY);
+    }
+
+    //     (mask != 0)
+    static size_t trailing_zeros(unsigned mask) {
+#ifdef __GNUC__
+        return static_cast<size_t>(__builtin_ctz(mask));
+#else
+        size_t count = 0;
+        while (!(mask & 1)) {
+            mask >>= 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    //      16- 
+    static size_t leading_zeros(unsigned mask) {
+        size_t count = 0;
+        for (unsigned bit = 1u << (GROUP - 1); bit && !(mask & bit); bit >>= 1) {
+            count++;
+        }
+        return count;
+    }
+
+    void set_ctrl(size_t index, signed char value) {
+        ctrl[index] = value;
+        if (index < GROUP - 1) {
+            ctrl[capacity + index] = value;
+        }
+    }
+
+    //     16, 32, 48, ... ( ,   16).
+    //   -       ,  16
+    //  ,  ,   .     ,
+    //         .
+    size_t find_index(const Key& key, size_t hash) const {
+        size_t mask = capacity - 1;
+        size_t position = h1(hash) & mask;
+        signed char tag = h2(hash);
+        for (size_t step = GROUP; ; step += GROUP) {
+            const signed char* group = &ctrl[position];
+            for (unsigned candidates = match(group, tag); candidates; candidates &= candidates - 1) {
+                size_t index = (position + trailing_zeros(candidates)) & mask;
+                if (equal(slots[index].key, key)) {
+                    return index;
+                }
+            }
+            if (match_empty(group)) {
+                return NOT_FOUND;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    //            hash
+    size_t find_insert_slot(size_t hash) const {
+        size_t mask = capacity - 1;
+        size_t position = h1(hash) & mask;
+        for (size_t step = GROUP; ; step += GROUP) {
+            unsigned free = match_free(&ctrl[position]);
+            if (free) {
+                return (position + trailing_zeros(free)) & mask;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    void allocate(size_t new_capacity) {
+        ctrl.assign(new_capacity + GROUP, EMPTY);
+        slots = static_cast<Slot*>(::operator new(new_capacity * sizeof(Slot)));
+        capacity = new_capacity;
+        growth_left = new_capacity - new_capacity / 8;
+        count_deleted = 0;
+    }
+
+    void destroy() {
+        for (size_t i = 0; i < capacity; i++) {
+            if (ctrl[i] >= 0) {
+                slots[i].~Slot();
+            }
+        }
+        ::operator delete(slots);
+    }
+
+    //   .      ,
+    //     ,   .
+    //  ,     .
+    void grow() {
+        size_t new_capacity = size * 16 >= capacity * 7 ? capacity * 2 : capacity;
+        std::vector<signed char> old_ctrl;
+        old_ctrl.swap(ctrl);
+        Slot* old_slots = slots;
+        size_t old_capacity = capacity;
+        allocate(new_capacity);
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_ctrl[i] >= 0) {
+                size_t hash = hasher(old_slots[i].key);
+                size_t index = find_insert_slot(hash);
+                new (&slots[index]) Slot(std::move(old_slots[i]));
+                set_ctrl(index, h2(hash));
+                old_slots[i].~Slot();
+            }
+        }
+        growth_left -= size;
+        ::operator delete(old_slots);
+    }
+};
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t SwissHashTable<Key, Value, Hash, KeyEqual>::GROUP;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t SwissHashTable<Key, Value, Hash, KeyEqual>::MIN_CAPACITY;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const size_t SwissHashTable<Key, Value, Hash, KeyEqual>::NOT_FOUND;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const signed char SwissHashTable<Key, Value, Hash, KeyEqual>::EMPTY;
+
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+const signed char SwissHashTable<Key, Value, Hash, KeyEqual>::DELETED;
+
+#endif // SWISSHASHTABLE_TEMPLATE_H
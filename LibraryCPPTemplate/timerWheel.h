@@ -0,0 +1,289 @@
+#ifndef TIMERWHEEL_TEMPLATE_H
+#define TIMERWHEEL_TEMPLATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "binaryHeap.h"
+
+//  :     .     ,
+//         .
+struct TimerHandle {
+    uint32_t index;
+    uint32_t generation;
+};
+
+//   .     (uint64_t).
+// 4   256 :  L  ,     256^(L + 1) ,
+//    L-   .      ,
+//      .     - O(1)
+// (      ),  -   .
+//   2^32         ,     .
+template <typename Data>
+class TimerWheel {
+public:
+    explicit TimerWheel(uint64_t startTime = 0) : now(startTime), freeHead(NIL), active(0) {
+        for (size_t i = 0; i < LEVELS * SLOTS; i++) {
+            slots[i] = NIL;
+        }
+        for (size_t i = 0; i < LEVELS; i++) {
+            levelCount[i] = 0;
+        }
+    }
+
+    //   
+    uint64_t getTime() const { return now; }
+
+    //       
+    size_t size() const { return active; }
+
+    bool empty() const { return active == 0; }
+
+    //    expiry;          
+    TimerHandle armAt(uint64_t expiry, const Data& data) {
+        if (expiry <= now) {
+            expiry = now + 1;
+        }
+        uint32_t index = allocateNode();
+        Node& node = nodes[index];
+        node.expiry = expiry;
+        node.data = data;
+        place(index);
+        active++;
+        TimerHandle handle = { index, node.generation };
+        return handle;
+    }
+
+    //   delay    
+    TimerHandle armAfter(uint64_t delay, const Data& data) {
+        return armAt(now + delay, data);
+    }
+
+    //  ; false,       
+    bool cancel(TimerHandle handle) {
+        if (!isActive(handle)) {
+            return false;
+        }
+        Node& node = nodes[handle.index];
+        if (node.state == IN_WHEEL) {
+            unlink(handle.index);
+        }
+        //          
+        releaseNode(handle.index);
+        active--;
+        return true;
+    }
+
+    bool isActive(TimerHandle handle) const {
+        return handle.index < nodes.size() && nodes[handle.index].generation == handle.generation
+            && nodes[handle.index].state != FREE;
+    }
+
+    //    time;      onExpire(data)
+    //     (getTime()   ).  onExpire     .
+    //     .    
+    template <typename Callback>
+    size_t advance(uint64_t time, Callback onExpire) {
+        size_t fired = 0;
+        while (now < time) {
+            moveFromHeap();
+            uint64_t target = skipTarget(time);
+            if (target > now) {
+                now = target;
+                continue;
+            }
+            fired += tick(onExpire);
+        }
+        return fired;
+    }
+
+private:
+    static const size_t LEVELS = 4;
+    static const size_t SLOT_BITS = 8;
+    static const size_t SLOTS = 1 << SLOT_BITS;
+    static const uint64_t WHEEL_RANGE = 1ull << (LEVELS * SLOT_BITS);
+    static const uint32_t NIL = static_cast<uint32_t>(-1);
+
+    enum NodeState { FREE, IN_WHEEL, IN_HEAP };
+
+    struct Node {
+        uint64_t expiry;
+        Data data;
+        uint32_t prev;       //         (next)
+        uint32_t next;
+        uint32_t slot;       //   ( * SLOTS + )
+        uint32_t generation;
+        NodeState state;
+    };
+
+    //    
+    struct FarTimer {
+        uint64_t expiry;
+        uint32_t index;
+        uint32_t generation;
+
+        bool operator<(const FarTimer& other) const { return expiry < other.expiry; }
+    };
+
+    uint64_t now;                       //  
+    std::vector<Node> nodes;            //  
+    uint32_t freeHead;                  //   
+    size_t active;                      //   
+    uint32_t slots[LEVELS * SLOTS];     //   
+    size_t levelCount[LEVELS];          //     
+    BinaryHeap<FarTimer> farTimers;     //    
+
+    uint32_t allocateNode() {
+        if (freeHead == NIL) {
+            if (nodes.size() >= NIL) {
+                throw std::length_error("Too many timers");
+            }
+            Node node = Node();
+            node.generation = 0;
+            node.state = FREE;
+            nodes.push_back(node);
+            return static_cast<uint32_t>(nodes.size() - 1);
+        }
+        uint32_t index = freeHead;
+        freeHead = nodes[index].next;
+        return index;
+    }
+
+    void releaseNode(uint32_t index) {
+        Node& node = nodes[index];
+        node.state = FREE;
+        node.generation++;
+        node.next = freeHead;
+        freeHead = index;
+    }
+
+    //      :       
+    void place(uint32_t index) {
+        Node& node = nodes[index];
+        uint64_t delta = node.expiry - now;
+        if (delta >= WHEEL_RANGE) {
+            node.state = IN_HEAP;
+            FarTimer far = { node.expiry, index, node.generation };
+            farTimers.insert(far);
+            return;
+        }
+        size_t level = 0;
+        while (delta >= (1ull << (SLOT_BITS * (level + 1)))) {
+            level++;
+        }
+        uint32_t slot = static_cast<uint32_t>(level * SLOTS + ((node.expiry >> (SLOT_BITS * level)) & (SLOTS - 1)));
+        node.state = IN_WHEEL;
+        node.slot = slot;
+        node.prev = NIL;
+        node.next = slots[slot];
+        if (node.next != NIL) {
+            nodes[node.next].prev = index;
+        }
+        slots[slot] = index;
+        levelCount[level]++;
+    }
+
+    void unlink(uint32_t index) {
+        Node& node = nodes[index];
+        if (node.prev != NIL) {
+            nodes[node.prev].next = node.next;
+        }
+        else {
+            slots[node.slot] = node.next;
+        }
+        if (node.next != NIL) {
+            nodes[node.next].prev = node.prev;
+        }
+        levelCount[node.slot / SLOTS]--;
+    }
+
+    //  ,      ,   
+    void moveFromHeap() {
+        while (!farTimers.empty() && farTimers.getMin().expiry - now < WHEEL_RANGE) {
+            FarTimer far = farTimers.extractMin();
+            Node& node = nodes[far.index];
+            if (node.generation == far.generation && node.state == IN_HEAP) {
+                place(far.index);
+            }
+        }
+    }
+
+    // ,       :   
+    //   ,    -    
+    uint64_t skipTarget(uint64_t time) const {
+        size_t level = 0;
+        while (level < LEVELS && levelCount[level] == 0) {
+            level++;
+        }
+        if (level == 0) {
+            return now;
+        }
+        uint64_t target = time;
+        if (level < LEVELS) {
+            uint64_t boundary = ((now >> (SLOT_BITS * level)) + 1) << (SLOT_BITS * level);
+            if (boundary - 1 < target) {
+                target = boundary - 1;
+            }
+        }
+        if (!farTimers.empty()) {
+            // ,        
+            uint64_t eligible = farTimers.getMin().expiry - WHEEL_RANGE;
+            if (eligible < target) {
+                target = eligible;
+            }
+        }
+        return target;
+    }
+
+    //  :   ,    ,     0
+    template <typename Callback>
+    size_t tick(Callback& onExpire) {
+        now++;
+        size_t top = 0;
+        while (top + 1 < LEVELS && (now & ((1ull << (SLOT_BITS * (top + 1))) - 1)) == 0) {
+            top++;
+        }
+        for (size_t level = top; level > 0; level--) {
+            uint32_t slot = static_cast<uint32_t>(level * SLOTS + ((now >> (SLOT_BITS * level)) & (SLOTS - 1)));
+            uint32_t index = slots[slot];
+            slots[slot] = NIL;
+            while (index != NIL) {
+                uint32_t next = nodes[index].next;
+                levelCount[level]--;
+                place(index);
+                index = next;
+            }
+        }
+
+        size_t fired = 0;
+        uint32_t slot = static_cast<uint32_t>(now & (SLOTS - 1));
+        while (slots[slot] != NIL) {
+            uint32_t index = slots[slot];
+            unlink(index);
+            Data data = nodes[index].data;
+            releaseNode(index);
+            active--;
+            fired++;
+            onExpire(data);
+        }
+        return fired;
+    }
+};
+
+template <typename Data>
+const size_t TimerWheel<Data>::LEVELS;
+
+template <typename Data>
+const size_t TimerWheel<Data>::SLOT_BITS;
+
+template <typename Data>
+const size_t TimerWheel<Data>::SLOTS;
+
+template <typename Data>
+const uint64_t TimerWheel<Data>::WHEEL_RANGE;
+
+template <typename Data>
+const uint32_t TimerWheel<Data>::NIL;
+
+#endif // TIMERWHEEL_TEMPLATE_H
@@ -0,0 +1,119 @@
+#ifndef TOPK_TEMPLATE_H
+#define TOPK_TEMPLATE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include "binaryHeap.h"
+
+//  k  ( Compare)    O(k) .
+//  -   k        .    ,
+//   ;         ,
+//         .
+//  k    std::greater<Data>.
+template <typename Data, typename Compare = std::less<Data>>
+class TopK {
+public:
+    explicit TopK(size_t k, const Compare& compare = Compare())
+        : k(k), compare(compare), heap(ReverseCompare(compare)) {
+        if (k == 0) {
+            throw std::invalid_argument("TopK capacity must be positive");
+        }
+        heap.reserve(k);
+    }
+
+    //   ; true,     k 
+    bool offer(const Data& value) {
+        if (heap.size() < k) {
+            heap.insert(value);
+            return true;
+        }
+        if (!compare(value, heap.getMin())) {
+            return false;
+        }
+        heap.replaceMin(value);
+        return true;
+    }
+
+    //   .   ,   
+    //    ( )        :
+    //          SIMD-.
+    //     ,     .
+    void offerBatch(const Data* values, size_t n) {
+        size_t i = 0;
+        for (; i < n && heap.size() < k; i++) {
+            heap.insert(values[i]);
+        }
+        unsigned char passed[FILTER_BLOCK];
+        while (i < n) {
+            size_t blockSize = n - i < FILTER_BLOCK ? n - i : FILTER_BLOCK;
+            const Data* block = values + i;
+            const Data threshold = heap.getMin();
+            unsigned char any = 0;
+            for (size_t j = 0; j < blockSize; j++) {
+                passed[j] = compare(block[j], threshold) ? 1 : 0;
+                any |= passed[j];
+            }
+            if (any) {
+                for (size_t j = 0; j < blockSize; j++) {
+                    //      ,      
+                    if (passed[j] && compare(block[j], heap.getMin())) {
+                        heap.replaceMin(block[j]);
+                    }
+                }
+            }
+            i += blockSize;
+        }
+    }
+
+    //     - ,     
+    const Data& threshold() const {
+        return heap.getMin();
+    }
+
+    size_t size() const { return heap.size(); }
+
+    size_t capacity() const { return k; }
+
+    bool full() const { return heap.size() == k; }
+
+    //       ;   
+    std::vector<Data> drainSorted() {
+        std::vector<Data> result;
+        result.reserve(heap.size());
+        heap.extractMany(heap.size(), std::back_inserter(result));
+        std::reverse(result.begin(), result.end());
+        return result;
+    }
+
+    void clear() {
+        heap.clear();
+    }
+
+private:
+    //    
+    static const size_t FILTER_BLOCK = 256;
+
+    //  :        
+    struct ReverseCompare {
+        Compare compare;
+
+        explicit ReverseCompare(const Compare& compare) : compare(compare) {}
+
+        bool operator()(const Data& a, const Data& b) const {
+            return compare(b, a);
+        }
+    };
+
+    size_t k;
+    Compare compare;
+    BinaryHeap<Data, ReverseCompare> heap;
+};
+
+template <typename Data, typename Compare>
+const size_t TopK<Data, Compare>::FILTER_BLOCK;
+
+#endif // TOPK_TEMPLATE_H